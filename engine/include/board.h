@@ -2,11 +2,14 @@
 #define SCRADLE_BOARD_H
 
 #include <array>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
 #include "cell.h"
 #include "move.h"
+#include "rule_set.h"
+#include "zobrist.h"
 
 namespace scradle {
 
@@ -16,10 +19,16 @@ class Board {
     static constexpr int SIZE = 15;
     static constexpr int CENTER = 7;
 
+    // One bit per square of a row or column
+    static constexpr uint16_t LINE_MASK = (1u << SIZE) - 1;
+
+    // Bytes per line in line(), padded with an empty square
+    static constexpr int LINE_STRIDE = 16;
+
     Board();
 
-    // Board access
-    Cell& getCell(int row, int col);
+    // Board access (read-only: every write goes through setLetter, which keeps
+    // the lines, masks and hash in step)
     const Cell& getCell(int row, int col) const;
 
     char getLetter(int row, int col) const;
@@ -33,6 +42,29 @@ class Board {
     bool isCenterOccupied() const;
     bool isBoardEmpty() const;
 
+    // Zobrist hash of the letters on the board (blanks distinct), kept up to
+    // date by setLetter; 0 for an empty board
+    uint64_t hash() const { return hash_; }
+
+    // Occupancy bitmasks, kept up to date by setLetter: bit `col` of
+    // rowOccupancy(row) and bit `row` of columnOccupancy(col) are set when
+    // the square holds a tile
+    uint16_t rowOccupancy(int row) const { return lines_[0].occupancy[row]; }
+    uint16_t columnOccupancy(int col) const { return lines_[1].occupancy[col]; }
+
+    // The letters of a row (HORIZONTAL) or column (VERTICAL) as one
+    // contiguous, 16-byte aligned line, ' ' for empty squares: square i of
+    // line(HORIZONTAL, r) is (r, i), of line(VERTICAL, c) is (i, c). Moves in
+    // either direction read their squares the same way.
+    const char* line(Direction dir, int index) const { return lines_[static_cast<int>(dir)].letters[index]; }
+    uint16_t lineOccupancy(Direction dir, int index) const {
+        return lines_[static_cast<int>(dir)].occupancy[index];
+    }
+
+    // Squares of a row or column next to a tile (isAnchor for the whole line)
+    uint16_t rowAnchors(int row) const;
+    uint16_t columnAnchors(int col) const;
+
     // Get existing prefix before a start position
     // Returns letters already on board before the start position in the given direction
     // Example: if board has "CAT" horizontally and start position is at the 'T', returns "CA"
@@ -53,10 +85,20 @@ class Board {
    private:
     std::array<Cell, SIZE * SIZE> cells_;
 
+    // Copies of the letters, row by row and column by column, kept by
+    // setLetter, with one occupancy bitmask per line
+    struct Lines {
+        alignas(LINE_STRIDE) char letters[SIZE][LINE_STRIDE];
+        uint16_t occupancy[SIZE];
+    };
+    Lines lines_[2];  // Indexed by Direction
+
+    uint64_t hash_ = 0;
+
     // Helper to get flat index
     int getIndex(int row, int col) const { return row * SIZE + col; }
 
-    // Initialize premium squares
+    // Copy the rule set's premium layout into the cells
     void initializePremiumSquares();
 };
 
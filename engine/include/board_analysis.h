@@ -0,0 +1,71 @@
+#ifndef SCRADLE_BOARD_ANALYSIS_H
+#define SCRADLE_BOARD_ANALYSIS_H
+
+#include <vector>
+
+#include "board.h"
+#include "cross_checks.h"
+#include "dawg.h"
+#include "move.h"
+
+namespace scradle {
+
+// Everything move generation reads from a board that does not depend on the
+// rack: start positions with the DAWG node and value of the tiles before
+// them, anchor squares and the cross-check table. Build it once and hand it
+// to MoveGenerator for any number of racks; it is read-only afterwards, so
+// generators on several threads may share it.
+//
+// The board, dictionary and any cross-check table given must outlive it.
+class BoardAnalysis {
+   public:
+    // The board tiles just before a start position (the existing prefix)
+    struct Prefix {
+        DAWG::Cursor node;  // Where the prefix leads in the DAWG (invalid if it is no word start)
+        int board_sum;      // Value of its tiles (blanks count 0)
+    };
+
+    struct Square {
+        int row;
+        int col;
+    };
+
+    // `cross_checks` must describe `board` for `dawg`; when omitted the
+    // analysis computes its own
+    BoardAnalysis(const Board& board, const DAWG& dawg, const CrossChecks* cross_checks = nullptr);
+
+    // Owns its cross-check table when it built it
+    BoardAnalysis(const BoardAnalysis&) = delete;
+    BoardAnalysis& operator=(const BoardAnalysis&) = delete;
+
+    const Board& getBoard() const { return board_; }
+    const DAWG& getDictionary() const { return dawg_; }
+    const CrossChecks& getCrossChecks() const { return *cross_checks_; }
+
+    // MoveGenerator::findStartPositions, and the prefix of each
+    const std::vector<StartPosition>& getStartPositions() const { return positions_; }
+    const std::vector<Prefix>& getPrefixes() const { return prefixes_; }
+
+    // Squares a move must cover one of, in board order: the center on an
+    // empty board, otherwise every empty square next to a tile
+    const std::vector<Square>& getAnchors() const { return anchors_; }
+
+    // The same, computed directly
+    static void findStartPositions(const Board& board, std::vector<StartPosition>& positions);
+    static Prefix readPrefix(const Board& board, const DAWG& dawg, const StartPosition& pos);
+    static void findAnchors(const Board& board, const CrossChecks& cross_checks, std::vector<Square>& anchors);
+
+   private:
+    const Board& board_;
+    const DAWG& dawg_;
+    const CrossChecks* cross_checks_;
+    CrossChecks owned_cross_checks_;
+
+    std::vector<StartPosition> positions_;
+    std::vector<Prefix> prefixes_;
+    std::vector<Square> anchors_;
+};
+
+}  // namespace scradle
+
+#endif  // SCRADLE_BOARD_ANALYSIS_H
@@ -0,0 +1,68 @@
+#ifndef SCRADLE_CROSS_CHECKS_H
+#define SCRADLE_CROSS_CHECKS_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "board.h"
+#include "dawg.h"
+#include "move.h"
+
+namespace scradle {
+
+// Cross-check table: for every square and play direction, the letters that
+// may be placed there without forming an invalid perpendicular word
+// Masks use DAWG::letterBit (bit 0-25 = 'A'-'Z'). A square with no
+// perpendicular neighbour allows every letter; an occupied square allows none.
+//
+// Alongside each mask it keeps the summed value of the perpendicular tiles,
+// so a placed tile's cross-word score is known without reading the board.
+// The table also caches anchors (empty squares next to a tile). A horizontal
+// move's mask only depends on the square's column and a vertical move's on
+// its row, so after a move only the lines through its tiles are recomputed.
+class CrossChecks {
+   public:
+    // Cross sum of a square whose tile would form no cross-word
+    static constexpr int NO_CROSS_WORD = -1;
+
+    CrossChecks();
+
+    // Recompute every square from the board
+    void compute(const Board& board, const DAWG& dawg);
+
+    // Recompute the rows and columns through `placements` after they were
+    // placed on or removed from the board
+    void update(const Board& board, const DAWG& dawg, Placements placements);
+
+    // Letters playable at (row, col) by a move going in `dir`
+    uint32_t get(int row, int col, Direction dir) const {
+        return masks_[static_cast<int>(dir)][row * Board::SIZE + col];
+    }
+
+    // Value of the tiles the cross-word at (row, col) would include besides
+    // the placed one (blanks count 0), or NO_CROSS_WORD
+    int getCrossSum(int row, int col, Direction dir) const {
+        return cross_sums_[static_cast<int>(dir)][row * Board::SIZE + col];
+    }
+
+    // Empty square with at least one tile next to it
+    bool isAnchor(int row, int col) const { return anchors_[row * Board::SIZE + col]; }
+
+   private:
+    // Indexed by Direction, then by square (row * SIZE + col)
+    std::array<uint32_t, Board::SIZE * Board::SIZE> masks_[2];
+    std::array<int16_t, Board::SIZE * Board::SIZE> cross_sums_[2];
+    std::array<bool, Board::SIZE * Board::SIZE> anchors_;
+
+    void computeRow(const Board& board, const DAWG& dawg, int row);
+    void computeColumn(const Board& board, const DAWG& dawg, int col);
+
+    // Allowed letters and cross sum of one square, from the tiles around it
+    // across `dir`
+    void computeSquare(const Board& board, const DAWG& dawg, int row, int col, Direction dir);
+};
+
+}  // namespace scradle
+
+#endif  // SCRADLE_CROSS_CHECKS_H
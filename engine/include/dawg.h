@@ -1,26 +1,66 @@
 #ifndef SCRADLE_DAWG_H
 #define SCRADLE_DAWG_H
 
+#include <cstdint>
 #include <string>
-#include <memory>
-#include <unordered_map>
+#include <type_traits>
 #include <vector>
 
 namespace scradle {
 
 // DAWG (Directed Acyclic Word Graph) for efficient word storage and lookup
 // A trie-like structure optimized for space by sharing common suffixes
+//
+// The graph is minimal: it is built from the sorted word list with Daciuk's
+// incremental algorithm, so equivalent suffix subtrees are merged into a
+// single node as soon as they are complete.
+//
+// Nodes and edges are stored in two flat arrays addressed by 32-bit indices.
+// The outgoing edges of a node are packed contiguously and sorted by letter,
+// and each node carries a bitmask of its child letters: following a letter is
+// a mask test plus a popcount to find the edge, with no search at all.
+//
+// The arrays can also be saved to a compiled binary file and memory-mapped
+// back read-only (loadMapped), in which case they are used in place without
+// parsing or allocation. The file uses native byte order.
 class DAWG {
 public:
+    using NodeIndex = uint32_t;
+
+    // Sentinel returned when a prefix/letter has no matching node
+    static constexpr NodeIndex NO_NODE = 0xFFFFFFFFu;
+
+    // Child masks: bit 0-25 = 'A'-'Z', bit 26 = the GADDAG separator (words
+    // are stored uppercase, the separator is the only symbol outside A-Z)
+    static constexpr int SEPARATOR_BIT = 26;
+    static constexpr uint32_t LETTER_MASK = (1u << 26) - 1;
+    static int letterBit(char letter) { return (letter >= 'A' && letter <= 'Z') ? letter - 'A' : SEPARATOR_BIT; }
+
     DAWG();
     ~DAWG();
 
+    // The DAWG may point into its own storage or into a file mapping
+    DAWG(const DAWG&) = delete;
+    DAWG& operator=(const DAWG&) = delete;
+
     // Build DAWG from a list of words
     void build(const std::vector<std::string>& words);
 
     // Load DAWG from a text file (one word per line)
     bool loadFromFile(const std::string& filename);
 
+    // Save to / map from the compiled binary format (see compile_dictionary)
+    bool saveBinary(const std::string& filename) const;
+    // loadMapped returns false for a missing file or one that is not a
+    // compiled DAWG, and throws std::runtime_error for one whose node or edge
+    // indices point outside its arrays (truncated or edited by hand)
+    bool loadMapped(const std::string& filename);
+
+    // Map `compiled` unless it is missing, corrupt or older than `word_list`
+    // (with a warning on stderr), otherwise load `word_list`
+    bool loadDictionary(const std::string& compiled, const std::string& word_list);
+    bool isMapped() const { return mapping_ != nullptr; }
+
     // Query operations
     bool contains(const std::string& word) const;
     bool hasPrefix(const std::string& prefix) const;
@@ -30,38 +70,110 @@ public:
 
     // Statistics
     int getWordCount() const { return word_count_; }
-    int getNodeCount() const { return node_count_; }
+    int getNodeCount() const { return static_cast<int>(node_count_); }
+    int getEdgeCount() const { return static_cast<int>(edge_count_); }
+    size_t getByteSize() const { return node_count_ * sizeof(Node) + edge_count_ * sizeof(Edge); }
 
     // Clear the DAWG
     void clear();
 
     // Node structure (public for move generator)
     struct Node {
-        std::unordered_map<char, std::shared_ptr<Node>> children;
+        uint32_t first_edge;  // Index of the first outgoing edge in the edge array
+        uint32_t child_mask;  // Bit set for each child letter (see letterBit)
+        uint8_t edge_count;   // Number of outgoing edges
         bool is_end_of_word;
+        uint16_t reserved;    // Explicit padding (kept zero in binary files)
+    };
 
-        Node() : is_end_of_word(false) {}
+    // Edge structure: a labelled transition to a child node
+    struct Edge {
+        NodeIndex target;
+        char letter;  // 'A'-'Z'
+        char reserved[3];  // Explicit padding (kept zero in binary files)
     };
 
-    // Get root node for traversal (needed by move generator)
-    std::shared_ptr<Node> getRoot() const { return root_; }
+    // Lightweight traversal API (needed by move generator)
+    NodeIndex getRoot() const { return 0; }
+    const Node& getNode(NodeIndex node) const { return nodes_[node]; }
+    bool isEndOfWord(NodeIndex node) const { return nodes_[node].is_end_of_word; }
+    uint32_t getChildMask(NodeIndex node) const { return nodes_[node].child_mask; }
+
+    // Child reached through a letter bit that is set in the node's child mask
+    // (edges are sorted, so its rank among the set bits is its edge offset)
+    NodeIndex getChildByBit(NodeIndex node, int bit) const {
+        const Node& n = nodes_[node];
+        return edges_[n.first_edge + __builtin_popcount(n.child_mask & ((1u << bit) - 1))].target;
+    }
+
+    // Outgoing edges of a node, sorted by letter: [edgesBegin, edgesEnd)
+    const Edge* edgesBegin(NodeIndex node) const { return edges_ + nodes_[node].first_edge; }
+    const Edge* edgesEnd(NodeIndex node) const { return edgesBegin(node) + nodes_[node].edge_count; }
+
+    // Follow the edge labelled with an uppercase letter (returns NO_NODE if absent)
+    NodeIndex getChild(NodeIndex node, char letter) const {
+        int bit = letterBit(letter);
+        return (nodes_[node].child_mask >> bit) & 1u ? getChildByBit(node, bit) : NO_NODE;
+    }
+
+    // Navigate to node at prefix (returns NO_NODE if prefix not found)
+    NodeIndex getNodeAt(const std::string& prefix) const;
+
+    // Read-only traversal position: a graph pointer and a node index, passed
+    // by value. Copying one touches no shared state, so any number of
+    // threads can walk the same DAWG at once.
+    class Cursor {
+    public:
+        Cursor() = default;
+        Cursor(const DAWG* dawg, NodeIndex node) : dawg_(dawg), node_(node) {}
+
+        bool valid() const { return node_ != NO_NODE; }
+        NodeIndex index() const { return node_; }
+        bool isEndOfWord() const { return dawg_->isEndOfWord(node_); }
+        uint32_t childMask() const { return dawg_->getChildMask(node_); }
+
+        // Same contracts as DAWG::getChild / DAWG::getChildByBit
+        Cursor child(char letter) const { return Cursor(dawg_, dawg_->getChild(node_, letter)); }
+        Cursor childByBit(int bit) const { return Cursor(dawg_, dawg_->getChildByBit(node_, bit)); }
+
+    private:
+        const DAWG* dawg_;
+        NodeIndex node_;
+    };
 
-    // Navigate to node at prefix (returns nullptr if prefix not found)
-    std::shared_ptr<Node> getNodeAt(const std::string& prefix) const;
+    Cursor cursor() const { return Cursor(this, getRoot()); }
+    Cursor cursorAt(const std::string& prefix) const { return Cursor(this, getNodeAt(prefix)); }
 
 private:
 
-    std::shared_ptr<Node> root_;
+    // Active storage: either the owned vectors or the file mapping
+    const Node* nodes_;
+    const Edge* edges_;
+    uint32_t node_count_;
+    uint32_t edge_count_;
     int word_count_;
-    int node_count_;
+
+    std::vector<Node> owned_nodes_;
+    std::vector<Edge> owned_edges_;
+    void* mapping_;
+    size_t mapping_size_;
+
+    void useOwnedStorage();
+    void unmap();
+
+    // Why the arrays of a compiled file cannot be traversed safely ("" if they can)
+    static std::string validateArrays(const Node* nodes, uint32_t node_count, const Edge* edges,
+                                      uint32_t edge_count);
 
     // Helper functions
-    void insertWord(const std::string& word);
-    void collectWords(const std::shared_ptr<Node>& node,
+    struct Builder;
+    void collectWords(NodeIndex node,
                      const std::string& prefix,
                      std::vector<std::string>& results) const;
 };
 
+static_assert(std::is_trivially_copyable<DAWG::Cursor>::value, "DAWG::Cursor must stay a plain value");
+
 } // namespace scradle
 
 #endif // SCRADLE_DAWG_H
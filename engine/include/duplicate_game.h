@@ -30,6 +30,7 @@ class DuplicateGame {
    private:
     const DAWG& dawg_;
     GameState state_;
+    MoveGenerator move_gen_;  // Reset for every move, keeping its buffers
     Scorer scorer_;
     std::mt19937 rng_;  // Random number generator for tie-breaking
 
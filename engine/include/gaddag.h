@@ -0,0 +1,56 @@
+#ifndef SCRADLE_GADDAG_H
+#define SCRADLE_GADDAG_H
+
+#include <string>
+#include <vector>
+
+#include "dawg.h"
+
+namespace scradle {
+
+// GADDAG lexicon (Gordon, 1994) for anchor-based move generation
+// Every word w is stored once per split point i as
+//     reverse(w[0..i]) + SEPARATOR + w[i..]
+// (the separator is omitted when the suffix is empty), so a word can be
+// grown outward from any of its letters: first leftwards, then rightwards
+// after crossing the separator.
+//
+// The paths are stored in a minimized DAWG, which shares the flat layout,
+// traversal API and binary format of the dictionary DAWG.
+class GADDAG {
+   public:
+    // Marks the switch from the reversed prefix to the suffix
+    static constexpr char SEPARATOR = '^';
+
+    GADDAG() = default;
+
+    // Build GADDAG from a list of words
+    void build(const std::vector<std::string>& words);
+
+    // Load GADDAG from a text file (one word per line)
+    bool loadFromFile(const std::string& filename);
+
+    // Save to / map from the compiled binary format
+    bool saveBinary(const std::string& filename) const { return graph_.saveBinary(filename); }
+    bool loadMapped(const std::string& filename) { return graph_.loadMapped(filename); }
+
+    // Query operations (a word is stored as its full reversal, without separator)
+    bool contains(const std::string& word) const;
+
+    // Statistics
+    int getNodeCount() const { return graph_.getNodeCount(); }
+    size_t getByteSize() const { return graph_.getByteSize(); }
+
+    // Underlying graph for traversal (needed by move generator)
+    const DAWG& getGraph() const { return graph_; }
+
+    // Clear the GADDAG
+    void clear() { graph_.clear(); }
+
+   private:
+    DAWG graph_;
+};
+
+}  // namespace scradle
+
+#endif  // SCRADLE_GADDAG_H
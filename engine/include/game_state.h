@@ -1,22 +1,32 @@
 #ifndef SCRADLE_GAME_STATE_H
 #define SCRADLE_GAME_STATE_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "board.h"
+#include "cross_checks.h"
 #include "dawg.h"
 #include "move.h"
+#include "move_code.h"
 #include "rack.h"
 #include "tile_bag.h"
 
 namespace scradle {
 
+class MoveGenerator;
+
 // Represents the complete state of a Scrabble game at a point in time
 class GameState {
    public:
     // Constructor with optional seed
     explicit GameState(unsigned int seed = 0);
+    ~GameState();
+
+    // Owns its move generator
+    GameState(GameState&&) noexcept;
+    GameState& operator=(GameState&&) noexcept;
 
     // Access game components
     Board& getBoard() { return board_; }
@@ -28,6 +38,13 @@ class GameState {
     TileBag& getTileBag() { return tile_bag_; }
     const TileBag& getTileBag() const { return tile_bag_; }
 
+    // Keep a cross-check table for `dawg` in step with the board: applyMove
+    // and undoLastMove then refresh only the rows and columns they touch.
+    // Tiles set through getBoard() directly are not tracked.
+    void setDictionary(const DAWG& dawg);
+    // Table for the current board (nullptr until a dictionary is set)
+    const CrossChecks* getCrossChecks() const { return dictionary_ ? &cross_checks_ : nullptr; }
+
     // Apply a move and update state
     void applyMove(const Move& move);
     bool findAndPlayBestMove(const DAWG& dawg, bool display = false);
@@ -46,8 +63,16 @@ class GameState {
     int getBingoCount() const { return bingo_count_; }
     unsigned int getSeed() const { return seed_; }
 
-    // Move history
-    const std::vector<Move>& getMoveHistory() const { return move_history_; }
+    // Zobrist hash of the board, rack and bag contents, for dedup sets and
+    // transposition tables: equal positions hash alike whatever the moves
+    // and draws that led to them
+    uint64_t hash() const { return board_.hash() ^ rack_.hash() ^ tile_bag_.hash(); }
+
+    // Move history, packed: decode each code against getBoard(), which
+    // rescores it, or on its own for the tiles alone
+    const std::vector<MoveCode>& getMoveCodes() const { return move_history_; }
+    // Move history decoded against the current board
+    std::vector<Move> getMoveHistory() const;
 
     // Reset to initial state
     void reset();
@@ -62,9 +87,21 @@ class GameState {
     TileBag tile_bag_;
     unsigned int seed_;
 
+    const DAWG* dictionary_;
+    CrossChecks cross_checks_;
+
     int total_score_;
     int bingo_count_;
-    std::vector<Move> move_history_;
+    std::vector<MoveCode> move_history_;
+    std::vector<int> move_scores_;  // Score of each move, as played
+
+    // findAndPlayBestMove's generator, built on first use and reset for
+    // every move so that its buffers are reused
+    std::unique_ptr<MoveGenerator> move_gen_;
+    const DAWG* move_gen_dawg_;
+
+    // The index-th move of the history, decoded against the current board
+    Move historyMove(size_t index) const;
 };
 
 }  // namespace scradle
@@ -1,6 +1,7 @@
 #ifndef SCRADLE_MOVE_H
 #define SCRADLE_MOVE_H
 
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -39,33 +40,64 @@ struct StartPosition {
 
 // Represents a single tile placement in a move
 struct TilePlacement {
-    int row;
-    int col;
+    int8_t row;
+    int8_t col;
     char letter;        // uppercase letter it represents
     bool is_from_rack;  // true if placed this turn, false if already on board
     bool is_blank;      // true if this is a blank tile (joker)
 
+    TilePlacement() : row(0), col(0), letter(' '), is_from_rack(true), is_blank(false) {}
     TilePlacement(int r, int c, char l, bool from_rack = true, bool blank = false)
-        : row(r), col(c), letter(l), is_from_rack(from_rack), is_blank(blank) {}
+        : row(static_cast<int8_t>(r)),
+          col(static_cast<int8_t>(c)),
+          letter(l),
+          is_from_rack(from_rack),
+          is_blank(blank) {}
+};
+
+// Read-only view of a run of tile placements (a Move's, or a vector's)
+struct Placements {
+    const TilePlacement* tiles;
+    int count;
+
+    Placements(const TilePlacement* t, int n) : tiles(t), count(n) {}
+    Placements(const std::vector<TilePlacement>& placements)
+        : tiles(placements.data()), count(static_cast<int>(placements.size())) {}
+
+    const TilePlacement* begin() const { return tiles; }
+    const TilePlacement* end() const { return tiles + count; }
+    const TilePlacement* data() const { return tiles; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const TilePlacement& operator[](size_t i) const { return tiles[i]; }
+    const TilePlacement& front() const { return tiles[0]; }
+    const TilePlacement& back() const { return tiles[count - 1]; }
+
+    operator std::vector<TilePlacement>() const { return std::vector<TilePlacement>(begin(), end()); }
 };
 
 // Represents a complete Scrabble move
+// Word and placements are stored inline (a move spans at most one board
+// line), so a Move is trivially copyable and never allocates.
 class Move {
    public:
+    static constexpr int MAX_LENGTH = 15;  // Board::SIZE
+
     Move();
+    // Throws std::runtime_error for a word longer than MAX_LENGTH
     Move(int start_row, int start_col, Direction dir, const std::string& word);
 
     // Getters
     int getStartRow() const { return start_row_; }
     int getStartCol() const { return start_col_; }
     Direction getDirection() const { return direction_; }
-    std::string getWord() const { return word_; }
-    const std::vector<TilePlacement>& getPlacements() const { return placements_; }
+    std::string getWord() const { return std::string(word_, word_length_); }
+    Placements getPlacements() const { return Placements(placements_, placement_count_); }
     int getScore() const { return score_; }
 
     // Setters
     void setScore(int score) { score_ = score; }
-    void addPlacement(const TilePlacement& placement);
+    void addPlacement(const TilePlacement& placement);  // Throws past MAX_LENGTH
 
     // Utility
     bool isValid() const;
@@ -73,11 +105,13 @@ class Move {
     bool isBingo() const;
 
    private:
-    int start_row_;
-    int start_col_;
+    int8_t start_row_;
+    int8_t start_col_;
     Direction direction_;
-    std::string word_;
-    std::vector<TilePlacement> placements_;
+    int8_t word_length_;
+    int8_t placement_count_;
+    char word_[MAX_LENGTH];
+    TilePlacement placements_[MAX_LENGTH];
     int score_;
 };
 
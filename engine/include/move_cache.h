@@ -0,0 +1,80 @@
+#ifndef SCRADLE_MOVE_CACHE_H
+#define SCRADLE_MOVE_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "board.h"
+#include "move.h"
+#include "move_generator.h"
+
+namespace scradle {
+
+// Least-recently-used memo of MoveGenerator results, keyed by the board's
+// letters, the letter counts (so racks are compared sorted) and the query.
+// Entries are found through the board's Zobrist hash (Board::hash) and
+// compared letter by letter, so a hash collision is a miss. Attach one with
+// MoveGenerator::setCache; a cache belongs to a single dictionary. Safe to
+// share between threads: two threads missing the same key both search, and
+// the second result simply refreshes the entry.
+class MoveCache {
+   public:
+    // Query of getBestMove; getTopMoves(n) uses n
+    static constexpr int BEST_MOVES = 0;
+
+    explicit MoveCache(size_t capacity = 4096);
+
+    // Copy the cached moves into `moves` and return true, or count a miss
+    bool lookup(const Board& board, const LetterCounts& letters, int query, std::vector<Move>& moves);
+
+    // Remember `moves`, evicting the least recently used entry when full
+    void store(const Board& board, const LetterCounts& letters, int query, const std::vector<Move>& moves);
+
+    void clear();
+
+    size_t size() const;
+    size_t capacity() const { return capacity_; }
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+
+   private:
+    using BoardLetters = std::array<char, Board::SIZE * Board::SIZE>;
+
+    struct Key {
+        uint64_t board_hash;
+        BoardLetters board;
+        LetterCounts letters;
+        int query;
+
+        bool operator==(const Key& other) const {
+            return board_hash == other.board_hash && query == other.query && letters == other.letters &&
+                   board == other.board;
+        }
+    };
+
+    static Key makeKey(const Board& board, const LetterCounts& letters, int query);
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    using Entry = std::pair<Key, std::vector<Move>>;
+
+    size_t capacity_;
+    std::list<Entry> entries_;  // Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+    mutable std::mutex mutex_;
+
+    std::atomic<uint64_t> hits_;
+    std::atomic<uint64_t> misses_;
+};
+
+}  // namespace scradle
+
+#endif  // SCRADLE_MOVE_CACHE_H
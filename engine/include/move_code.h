@@ -0,0 +1,87 @@
+#ifndef SCRADLE_MOVE_CODE_H
+#define SCRADLE_MOVE_CODE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "board.h"
+#include "move.h"
+#include "rack.h"
+
+namespace scradle {
+
+// A move packed into 64 bits, for game histories, logs and hash tables: the
+// squares its rack tiles cover, with their letters and blanks. Two moves
+// share a code only when they place the same tiles on the same squares.
+// decode() rebuilds those placements on its own; decode(board) also reads
+// the whole word from a board the move has been played on and rescores it.
+//
+// Bit layout, low to high:
+//   0-14  squares placed along the line (bit i = i-th square of the line)
+//   15-18 line: the row of a horizontal move, the column of a vertical one
+//   19    direction
+//   20-54 letters placed, 5 bits each ('A' = 0), in line order
+//   55-61 blank flags of those letters, in the same order
+//   62-63 unused
+class MoveCode {
+   public:
+    // A move places at most a rack's worth of tiles
+    static constexpr int MAX_TILES = Rack::MAX_TILES;
+    static_assert(Board::SIZE + 4 + 1 + MAX_TILES * 6 <= 64, "A code must fit in 64 bits");
+
+    MoveCode() : value_(0) {}
+    explicit MoveCode(uint64_t value) : value_(value) {}
+
+    // Throws std::runtime_error for more than MAX_TILES rack tiles, tiles
+    // off the move's line or a letter outside 'A'-'Z'
+    static MoveCode encode(const Move& move);
+
+    // The rack tiles alone: a move starting at the first of them, whose word
+    // is their letters, unscored
+    Move decode() const;
+
+    // The move as played on `board` (the board right after the move or any
+    // later one): its whole word, its rack tiles and its score
+    Move decode(const Board& board) const;
+
+    uint64_t value() const { return value_; }
+
+    Direction getDirection() const { return field(19, 1) ? Direction::VERTICAL : Direction::HORIZONTAL; }
+    int getLine() const { return field(15, 4); }
+    int getSquares() const { return field(0, 15); }
+
+    // Tiles placed from the rack
+    int getTileCount() const { return __builtin_popcount(getSquares()); }
+    bool isBingo() const { return getTileCount() == MAX_TILES; }
+
+    bool operator==(MoveCode other) const { return value_ == other.value_; }
+    bool operator!=(MoveCode other) const { return value_ != other.value_; }
+    bool operator<(MoveCode other) const { return value_ < other.value_; }
+
+   private:
+    uint64_t value_;
+
+    int field(int shift, int bits) const { return static_cast<int>((value_ >> shift) & ((1ull << bits) - 1)); }
+};
+
+}  // namespace scradle
+
+namespace std {
+
+template <>
+struct hash<scradle::MoveCode> {
+    // Fold the high bits into the low ones: codes differing only in their
+    // letters would otherwise share buckets
+    size_t operator()(scradle::MoveCode code) const {
+        uint64_t x = code.value();
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        return static_cast<size_t>(x);
+    }
+};
+
+}  // namespace std
+
+#endif  // SCRADLE_MOVE_CODE_H
@@ -1,23 +1,31 @@
 #ifndef SCRADLE_MOVE_GENERATOR_H
 #define SCRADLE_MOVE_GENERATOR_H
 
-#include <memory>
+#include <array>
+#include <atomic>
 #include <set>
+#include <type_traits>
 #include <vector>
 
 #include "board.h"
+#include "board_analysis.h"
+#include "cross_checks.h"
 #include "dawg.h"
+#include "gaddag.h"
 #include "move.h"
 #include "rack.h"
 
 namespace scradle {
 
+class MoveCache;
+
 // Represents a raw move before validation
 struct RawMove {
     std::vector<TilePlacement> placements;
     Direction direction;
     int start_row;
     int start_col;
+    int score = 0;  // Set by the generator as tiles are placed
 
     std::string toString() const {
         std::string result = "RawMove(";
@@ -38,59 +46,403 @@ struct RawMove {
     }
 };
 
+// A valid move as handed to a MoveGenerator::forEachMove visitor: the placed
+// tiles in board order and the move's score. The tiles live in the
+// generator's scratch space and are only valid during the call.
+struct MoveView {
+    Direction direction;
+    int score;
+    int tile_count;
+    const TilePlacement* tiles;
+
+    const TilePlacement* begin() const { return tiles; }
+    const TilePlacement* end() const { return tiles + tile_count; }
+};
+
+// Tiles a generator may play, per letter: A-Z = 0-25, blank = 26
+// There may be any number of them (e.g. the whole bag); a move still places
+// at most Rack::MAX_TILES.
+using LetterCounts = std::array<int, 27>;
+
 // Generates all valid moves for a given board state and rack
+//
+// Two generation engines are available and produce identical move lists:
+// - start positions (default): a DAWG walk from every square where a word
+//   may begin, re-reading the board prefix before that square
+// - anchors (when a GADDAG is given): words are grown outward from each
+//   anchor square, leftwards first and then rightwards
 class MoveGenerator {
    public:
-    MoveGenerator(const Board& board, const Rack& rack, const DAWG& dawg);
+    // `cross_checks` must describe `board` for `dawg` (e.g. GameState's
+    // table); when omitted the generator computes its own on first use
+    MoveGenerator(const Board& board, const Rack& rack, const DAWG& dawg,
+                  const CrossChecks* cross_checks = nullptr);
+    MoveGenerator(const Board& board, const Rack& rack, const DAWG& dawg, const GADDAG& gaddag,
+                  const CrossChecks* cross_checks = nullptr);
+
+    // Generate from letter counts rather than a rack, e.g. a "super-rack"
+    // holding every unseen tile
+    MoveGenerator(const Board& board, const LetterCounts& letters, const DAWG& dawg,
+                  const CrossChecks* cross_checks = nullptr);
+    MoveGenerator(const Board& board, const LetterCounts& letters, const DAWG& dawg, const GADDAG& gaddag,
+                  const CrossChecks* cross_checks = nullptr);
+
+    // Generate from a prepared analysis of the board (see BoardAnalysis),
+    // which must outlive the generator's searches
+    MoveGenerator(const BoardAnalysis& analysis, const LetterCounts& letters);
+    MoveGenerator(const BoardAnalysis& analysis, const LetterCounts& letters, const GADDAG& gaddag);
 
-    // Generate all valid moves
+    // Letter counts of a tile string ('?' = blank)
+    static LetterCounts countLetters(const std::string& tiles);
+
+    // Point the generator at another position (same dictionary and engine)
+    // Search buffers keep their capacity from one call to the next, so a
+    // long-lived generator, one per thread, avoids most allocations.
+    void reset(const Board& board, const Rack& rack, const CrossChecks* cross_checks = nullptr);
+    void reset(const Board& board, const LetterCounts& letters, const CrossChecks* cross_checks = nullptr);
+    // `analysis` must be for the generator's dictionary
+    void reset(const BoardAnalysis& analysis, const LetterCounts& letters);
+
+    // Search on up to `threads` OpenMP threads (0 = OpenMP default, 1 =
+    // serial, the default) in generateMoves, getBestMove and getTopMoves.
+    // Work is split by start position or anchor and by first tile; results
+    // are merged back so the output does not depend on the thread count.
+    void setThreads(int threads);
+
+    // Serve getBestMove and getTopMoves from `cache` when it holds the same
+    // board, letters and query, and record fresh results in it (nullptr,
+    // the default, turns caching off). The cache must outlive its use here.
+    void setCache(MoveCache* cache);
+
+    // Generate all valid moves, already scored
     std::vector<Move> generateMoves();
 
+    // Call visitor(const MoveView&) for every valid move, without building
+    // RawMove or Move objects. The start-position engine visits moves in
+    // generateMoves order, the anchor engine anchor by anchor. Always serial.
+    template <typename Visitor>
+    void forEachMove(Visitor&& visitor) const {
+        auto visit = [&visitor](int, const MoveView& move) { visitor(move); };
+        TaskSink sink = makeTaskSink(visit);
+        visitMoves(&sink, 1);
+    }
+
+    // Build the Move (main word, start square, score) for a visited move
+    Move toMove(const MoveView& view) const;
+
     // Step 1: Find all start positions (exposed for testing)
     std::vector<StartPosition> findStartPositions() const;
 
     // Step 2: Generate all possible raw moves (exposed for testing)
     std::vector<RawMove> generateRawMoves(const std::vector<StartPosition>& positions) const;
 
+    // Steps 1+2 for the anchor engine: raw moves grown from every anchor
+    // through the GADDAG, in the same order as the start-position engine
+    std::vector<RawMove> generateAnchorRawMoves() const;
+
     // Step 3 helpers (exposed for testing)
+    // Generated moves already satisfy these; isValidMove re-checks a move
+    // built by hand against the dictionary
     std::string getMainWord(const RawMove& raw_move) const;
     std::vector<std::string> getCrossWords(const RawMove& raw_move) const;
     bool isValidMove(const RawMove& raw_move) const;
 
     // Get best moves (all moves with the highest score)
+    // Best-only search: start positions (or anchors) are explored in order of
+    // an optimistic score bound, and branches whose bound falls below the
+    // best score found so far are skipped. A blank only stands for a letter
+    // no longer available as a regular tile (anything else scores less) and
+    // is then moved to whichever square it costs least on. Tied moves are all
+    // returned, in generateMoves order.
     std::vector<Move> getBestMove();
 
-    // Get top X moves sorted by score (descending)
+    // Get top X moves sorted by score (descending, ties in generateMoves
+    // order). Moves stream through a heap of `count` moves, and the search
+    // skips branches that cannot beat the worst of them once it is full.
     std::vector<Move> getTopMoves(int count);
 
    private:
-    const Board& board_;
-    const Rack& rack_;
+    const Board* board_;
+    LetterCounts letters_;
+    int tile_count_;
     const DAWG& dawg_;
+    const GADDAG* gaddag_;  // Selects the anchor engine when set
+    int threads_;
+    MoveCache* cache_;
+    const BoardAnalysis* analysis_;  // Board-only work done up front, when given
+
+    // Letters allowed per square: the caller's table or a lazily computed one
+    mutable const CrossChecks* cross_checks_;
+    mutable CrossChecks owned_cross_checks_;
+    const CrossChecks& crossChecks() const;
+
+    // Non-owning, non-allocating reference to a move visitor
+    struct MoveSink {
+        void* context;
+        void (*visit)(void* context, const MoveView& move);
+
+        void operator()(const MoveView& move) const { visit(context, move); }
+    };
+
+    template <typename Visitor>
+    static MoveSink makeSink(Visitor& visitor) {
+        using V = std::remove_reference_t<Visitor>;
+        return MoveSink{const_cast<void*>(static_cast<const void*>(&visitor)),
+                        [](void* context, const MoveView& move) { (*static_cast<V*>(context))(move); }};
+    }
+
+    // The moves of one search thread, each with the task it was found in
+    // (tasks are numbered in serial search order)
+    struct TaskSink {
+        void* context;
+        void (*visit)(void* context, int task, const MoveView& move);
+
+        void operator()(int task, const MoveView& move) const { visit(context, task, move); }
+    };
+
+    template <typename Visitor>
+    static TaskSink makeTaskSink(Visitor& visitor) {
+        using V = std::remove_reference_t<Visitor>;
+        return TaskSink{const_cast<void*>(static_cast<const void*>(&visitor)),
+                        [](void* context, int task, const MoveView& move) { (*static_cast<V*>(context))(task, move); }};
+    }
+
+    // Moves of one task, forwarded to the sink of the thread running it
+    struct TaskMoves {
+        const TaskSink* sink;
+        int task;
+
+        void operator()(const MoveView& move) const { (*sink)(task, move); }
+    };
+
+    // Bounded search state (getBestMove, getTopMoves): the rack's best tile
+    // values and the score a branch must still be able to reach
+    struct ScoreBound {
+        int top_sums[Rack::MAX_TILES + 1];  // Sum of the i highest tile values on the rack (blanks = 0)
+        int best_value;                     // Highest tile value on the rack
+        int tile_count;                     // Tiles on the rack
+        bool best_only;                     // Only the best moves are wanted (see getBestMove)
+        std::atomic<int> floor_score{0};    // Lowest score still worth finding (shared by all threads)
+
+        int floor() const { return floor_score.load(std::memory_order_relaxed); }
+        void raiseFloor(int score) {
+            int current = floor();
+            while (score > current && !floor_score.compare_exchange_weak(current, score, std::memory_order_relaxed)) {
+            }
+        }
+    };
+    void initScoreBound(ScoreBound& bound) const;
 
-    // DFS-based move generation using DAWG traversal
+    // Run the selected engine over `sink_count` threads, thread i passing
+    // its moves to sinks[i]; with a bound, only moves that can reach
+    // bound->floor() are searched for
+    void visitMoves(const TaskSink* sinks, int sink_count, const ScoreBound* bound = nullptr) const;
+    void visitStartPositionMoves(const std::vector<StartPosition>& positions, const TaskSink* sinks,
+                                 int sink_count, const ScoreBound* bound = nullptr) const;
+    void visitAnchorMoves(const TaskSink* sinks, int sink_count, const ScoreBound* bound = nullptr) const;
+
+    // visitMoves on threads_ threads, each visiting as visit(states[i], task, move)
+    template <typename State, typename Visit>
+    void visitPerThread(std::vector<State>& states, const Visit& visit, const ScoreBound* bound = nullptr) const {
+        auto bind = [&visit](State& state) {
+            return [&visit, &state](int task, const MoveView& move) { visit(state, task, move); };
+        };
+        if (states.size() == 1) {
+            auto visitor = bind(states[0]);
+            TaskSink sink = makeTaskSink(visitor);
+            visitMoves(&sink, 1, bound);
+            return;
+        }
+        std::vector<decltype(bind(states[0]))> visitors;
+        std::vector<TaskSink> sinks;
+        visitors.reserve(states.size());
+        for (auto& state : states) {
+            visitors.push_back(bind(state));
+        }
+        for (auto& visitor : visitors) {
+            sinks.push_back(makeTaskSink(visitor));
+        }
+        visitMoves(sinks.data(), static_cast<int>(sinks.size()), bound);
+    }
+    int threadCount() const;
+
+    // A lone tile only forms a word if a tile touches it along the move
+    bool hasNeighbourAlong(const TilePlacement& tile, Direction dir) const;
+
+    // Put anchor engine moves back in start-position order
+    void sortCanonical(std::vector<Move>& moves) const;
+
+    static RawMove toRawMove(const MoveView& view);
+
+    // findStartPositions into a reused buffer
+    void findStartPositions(std::vector<StartPosition>& positions) const;
+
+    // Fill letter_count (A-Z = 0-25, blank = 26) from the generator's tiles
+    // Returns false if there are none
+    bool countRackLetters(int letter_count[27]) const;
+
+    // Letters held as regular tiles, one bit per letter (see DAWG::letterBit)
+    static uint32_t rackMask(const int letter_count[27]);
+
+    // Score of the word built so far, updated in O(1) per tile
+    struct RunningScore {
+        int main_sum = 0;         // Main word letters (letter premiums applied)
+        int word_multiplier = 1;  // Word premiums covered by placed tiles
+        int cross_total = 0;      // Cross-words formed by placed tiles, fully scored
+    };
+
+    // Add a tile read from the board / placed from the rack to the score
+    RunningScore addBoardTile(RunningScore score, int row, int col) const;
+    RunningScore addPlacedTile(RunningScore score, int row, int col, Direction dir,
+                               int letter_index, bool is_blank) const;
+    static int finalScore(const RunningScore& score, int tiles_placed);
+
+    // Squares a move may still cover, summarized for a score bound
+    struct BoundWindow {
+        int board_sum = 0;                 // Board tiles inside the window
+        int letter_premiums[4] = {};       // Empty squares per letter multiplier
+        int word_premiums[4] = {};         // Empty squares per word multiplier
+        int cross_scores[Board::SIZE];     // Best cross-word score of each empty square
+        int empty_count = 0;
+    };
+    void addToWindow(BoundWindow& window, int row, int col, Direction dir, const ScoreBound& bound) const;
+
+    // Most that up to `tiles_left` more tiles on the window can add to a move
+    // already holding `tiles_placed` tiles: the best rack values on the best
+    // letter premiums, the best word premiums and cross-words, every board
+    // tile of the window, and the bingo bonus (counted in cross_total)
+    static RunningScore bestExtension(const BoundWindow& window, int tiles_left, int tiles_placed,
+                                      const ScoreBound& bound);
+
+    // Highest final score of a move at `score` extended by `extension`
+    static int upperBound(const RunningScore& score, const RunningScore& extension);
+
+    // Start-position engine: bestExtension once `i` tiles are placed (the
+    // next tile then goes on the position's i-th empty square)
+    struct PositionBound {
+        const ScoreBound* search;
+        RunningScore extensions[Rack::MAX_TILES + 1];
+        int tile_limit;  // Tiles the position can take from the rack
+    };
+    void boundPosition(const StartPosition& pos, PositionBound& bound) const;
+
+    // Start-position engine: a start position's DAWG node and score after
+    // the board prefix
+    struct Start {
+        const StartPosition* pos;
+        DAWG::Cursor node;
+        RunningScore score;
+        PositionBound bound;
+        int upper_bound;
+    };
+
+    // Anchor engine: an anchor square, searched in one direction
+    struct Anchor {
+        int row;
+        int col;
+        Direction direction;
+        int upper_bound;
+    };
+
+    // One unit of search work: a Start or Anchor (by index) and the letters
+    // its first tile may take
+    struct SearchTask {
+        int item;
+        uint32_t first_letters;
+    };
+
+    // Buffers reused by every search of this generator: cleared, not freed
+    struct Scratch {
+        std::vector<StartPosition> positions;
+        std::vector<BoardAnalysis::Square> anchor_squares;
+        std::vector<Start> starts;
+        std::vector<Anchor> anchors;
+        std::vector<SearchTask> tasks;
+        std::vector<std::vector<Move>> moves;  // Per thread (getBestMove, getTopMoves)
+    };
+    mutable Scratch scratch_;
+
+    // scratch_.moves, emptied, one per search thread
+    std::vector<std::vector<Move>>& threadMoves();
+
+    // Anchor engine: upperBound of every move grown from an anchor
+    int anchorUpperBound(int row, int col, Direction dir, const ScoreBound& bound) const;
+
+    // DFS-based move generation using DAWG traversal; the tile on the start
+    // square is limited to `first_letters`
     void dfsGenerateMoves(
         int letter_count[27],
-        std::shared_ptr<DAWG::Node> node,
+        uint32_t rack_mask,
+        DAWG::Cursor node,
         std::string& tiles_from_rack,
         int position_offset,
         const StartPosition& pos,
-        std::vector<RawMove>* raw_moves) const;
+        RunningScore score,
+        const MoveSink& sink,
+        const PositionBound* bound,
+        uint32_t first_letters) const;
+
+    // Anchor engine: the anchor being expanded and the tiles placed so far
+    struct AnchorSearch {
+        int row;
+        int col;
+        Direction direction;
+        TilePlacement placed[Rack::MAX_TILES];
+        int placed_count;
+        const MoveSink* sink;
+        uint32_t first_letters;   // Letters the tile on the anchor may take
+        const ScoreBound* bound;  // Set for bounded (best-only or top) searches
+    };
+
+    // Anchor engine: place or read the square at `offset` from the anchor
+    // (negative = before the anchor, positive = after it)
+    void gaddagGenerate(int letter_count[27], uint32_t rack_mask, DAWG::Cursor node, int offset,
+                        RunningScore score, AnchorSearch& search) const;
+
+    // Anchor engine: continue from the square at `offset` once it is filled
+    void gaddagContinue(int letter_count[27], uint32_t rack_mask, DAWG::Cursor node, int offset,
+                        RunningScore score, AnchorSearch& search) const;
+
+    // Bounded searches place a letter's regular tiles before its blanks and
+    // score blanks as regular tiles (which keeps score bounds valid). Visit
+    // the found word with every playable choice of blank squares, at its
+    // real score; a best-only search only wants the choices that cost least.
+    void visitBlankAssignments(const MoveView& move, const MoveSink& sink, bool best_only) const;
+
+    // Anchor engine: visit the tiles placed so far as a move
+    void recordAnchorMove(const AnchorSearch& search, const RunningScore& score) const;
+
+    // Square at `offset` from the anchor along the search direction
+    bool isOnBoardAt(const AnchorSearch& search, int offset, int& row, int& col) const;
+
+    // Helper: Lay a tile sequence out from a start position, skipping
+    // occupied squares; returns the number of tiles written
+    int layoutTiles(const std::string& tile_sequence, const StartPosition& pos, TilePlacement* tiles) const;
 
-    // Helper: Generate raw move for a specific tile sequence and start position
-    RawMove createRawMove(
-        const std::string& tile_sequence,
-        const StartPosition& pos) const;
+    // A row (horizontal moves) or column (vertical moves) of the board, read
+    // through Board::line: a move's squares are offsets along it, so walks in
+    // either direction run the same contiguous code
+    struct Line {
+        const char* letters;  // Board::line, ' ' for empty squares
+        uint16_t occupied;    // Board::lineOccupancy
+        int index;            // The row or column
+        Direction direction;
 
-    // Step 3: Validate moves
-    std::vector<Move> filterValidMoves(const std::vector<RawMove>& raw_moves) const;
+        bool isEmpty(int offset) const { return ((occupied >> offset) & 1) == 0; }
+        int row(int offset) const { return direction == Direction::HORIZONTAL ? index : offset; }
+        int col(int offset) const { return direction == Direction::HORIZONTAL ? offset : index; }
+    };
 
-    // Helper: Convert RawMove to Move
-    Move rawMoveToMove(const RawMove& raw_move, const std::string& word) const;
+    // The line through (row, col) along `dir`; `offset` gets the square's
+    // offset on it
+    Line lineThrough(int row, int col, Direction dir, int& offset) const;
 
-    // Utility functions
-    void getNext(int& row, int& col, Direction dir) const;
-    void getPrev(int& row, int& col, Direction dir) const;
+    // The word along `line` through the square at `offset` once `tiles` are
+    // laid on its empty squares (tiles off the line are ignored), uppercase;
+    // `start` gets the offset of its first letter. Stops short of `offset`
+    // if that square stays empty.
+    static std::string readWord(const Line& line, int offset, const TilePlacement* tiles, int tile_count,
+                                int& start);
 };
 
 }  // namespace scradle
@@ -0,0 +1,64 @@
+#ifndef SCRADLE_PREMIUM_LAYOUT_H
+#define SCRADLE_PREMIUM_LAYOUT_H
+
+#include "cell.h"
+
+namespace scradle {
+
+// Premium squares of a 15x15 board, built at compile time. Board copies it
+// into its cells; scoring code may read it directly.
+struct PremiumLayout {
+    static constexpr int SIZE = 15;
+
+    PremiumType squares[SIZE * SIZE];
+
+    constexpr PremiumType at(int row, int col) const { return squares[row * SIZE + col]; }
+};
+
+namespace detail {
+
+template <int N>
+constexpr void setPremiums(PremiumLayout& layout, const int (&positions)[N][2], PremiumType premium) {
+    for (const auto& pos : positions) {
+        layout.squares[pos[0] * PremiumLayout::SIZE + pos[1]] = premium;
+    }
+}
+
+constexpr PremiumLayout makeStandardLayout() {
+    PremiumLayout layout{};
+    for (auto& square : layout.squares) {
+        square = PremiumType::NONE;
+    }
+
+    // Triple Word Score (TW)
+    constexpr int tw_positions[][2] = {
+        {0, 0}, {0, 7}, {0, 14}, {7, 0}, {7, 14}, {14, 0}, {14, 7}, {14, 14}};
+    setPremiums(layout, tw_positions, PremiumType::TRIPLE_WORD);
+
+    // Double Word Score (DW)
+    constexpr int dw_positions[][2] = {
+        {1, 1}, {2, 2}, {3, 3}, {4, 4}, {1, 13}, {2, 12}, {3, 11}, {4, 10}, {13, 1}, {12, 2}, {11, 3}, {10, 4}, {13, 13}, {12, 12}, {11, 11}, {10, 10}, {7, 7}  // Center square
+    };
+    setPremiums(layout, dw_positions, PremiumType::DOUBLE_WORD);
+
+    // Triple Letter Score (TL)
+    constexpr int tl_positions[][2] = {
+        {1, 5}, {1, 9}, {5, 1}, {5, 5}, {5, 9}, {5, 13}, {9, 1}, {9, 5}, {9, 9}, {9, 13}, {13, 5}, {13, 9}};
+    setPremiums(layout, tl_positions, PremiumType::TRIPLE_LETTER);
+
+    // Double Letter Score (DL)
+    constexpr int dl_positions[][2] = {
+        {0, 3}, {0, 11}, {2, 6}, {2, 8}, {3, 0}, {3, 7}, {3, 14}, {6, 2}, {6, 6}, {6, 8}, {6, 12}, {7, 3}, {7, 11}, {8, 2}, {8, 6}, {8, 8}, {8, 12}, {11, 0}, {11, 7}, {11, 14}, {12, 6}, {12, 8}, {14, 3}, {14, 11}};
+    setPremiums(layout, dl_positions, PremiumType::DOUBLE_LETTER);
+
+    return layout;
+}
+
+}  // namespace detail
+
+// Standard Scrabble premium square layout
+inline constexpr PremiumLayout STANDARD_LAYOUT = detail::makeStandardLayout();
+
+}  // namespace scradle
+
+#endif  // SCRADLE_PREMIUM_LAYOUT_H
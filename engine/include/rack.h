@@ -1,6 +1,7 @@
 #ifndef SCRADLE_RACK_H
 #define SCRADLE_RACK_H
 
+#include <cstdint>
 #include <string>
 
 namespace scradle {
@@ -18,7 +19,10 @@ public:
     char getTile(int index) const;
     void setTiles(const std::string& tiles);
     const std::string& getTiles() const { return tiles_; }
-    void clear() { tiles_.clear(); }
+    void clear() {
+        tiles_.clear();
+        hash_ = 0;
+    }
 
     // Tile operations
     bool hasTile(char letter) const;
@@ -32,11 +36,18 @@ public:
     // After move 15: needs >= 1 vowel AND >= 1 consonant
     bool isValid(int move_count) const;
 
+    // Zobrist hash of the tiles, whatever their order (see zobrist.h)
+    uint64_t hash() const { return hash_; }
+
     // Display
     std::string toString() const;
 
 private:
     std::string tiles_;  // Current tiles in rack
+    uint64_t hash_;
+
+    // Hash tiles_ from scratch
+    void rehash();
 };
 
 } // namespace scradle
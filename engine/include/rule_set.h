@@ -0,0 +1,114 @@
+#ifndef SCRADLE_RULE_SET_H
+#define SCRADLE_RULE_SET_H
+
+#include <array>
+#include <cstdint>
+
+#include "premium_layout.h"
+
+namespace scradle {
+
+// Rule sets: the per-language tables of the game, all known at compile time.
+// A rule set is a struct with these members (see FrenchRules):
+//   LETTER_VALUES  value of 'A'-'Z'
+//   TILE_COUNTS    tiles of 'A'-'Z' in the bag, then blanks
+//   VOWELS         vowel letters, one bit per letter ('A' = bit 0)
+//   LAYOUT         premium squares
+//   BINGO_BONUS    bonus for playing a whole rack
+// The engine is built for one of them, Rules (below), and Board, Scorer,
+// TileBag and MoveGenerator read their tables straight from it, so the
+// compiler folds the values into the loops that use them.
+
+namespace detail {
+
+constexpr uint32_t letterBits(const char* letters) {
+    uint32_t bits = 0;
+    for (; *letters != '\0'; letters++) {
+        bits |= 1u << (*letters - 'A');
+    }
+    return bits;
+}
+
+}  // namespace detail
+
+// French Scrabble (ODS)
+struct FrenchRules {
+    static constexpr std::array<int, 26> LETTER_VALUES = {
+        1,   // A
+        3,   // B
+        3,   // C
+        2,   // D
+        1,   // E
+        4,   // F
+        2,   // G
+        4,   // H
+        1,   // I
+        8,   // J
+        10,  // K
+        1,   // L
+        2,   // M
+        1,   // N
+        1,   // O
+        3,   // P
+        8,   // Q
+        1,   // R
+        1,   // S
+        1,   // T
+        1,   // U
+        4,   // V
+        10,  // W
+        10,  // X
+        10,  // Y
+        10,  // Z
+    };
+
+    // A-Z, then blanks: 45 vowels, 55 consonants and 2 blanks
+    static constexpr std::array<int, 27> TILE_COUNTS = {
+        9, 2, 2, 3, 15, 2, 2, 2, 8, 1, 1, 5, 3, 6, 6, 2, 1, 6, 6, 6, 6, 2, 1, 1, 1, 1, 2};
+
+    // Y is a vowel in French
+    static constexpr uint32_t VOWELS = detail::letterBits("AEIOUY");
+
+    static constexpr const PremiumLayout& LAYOUT = STANDARD_LAYOUT;
+    static constexpr int BINGO_BONUS = 50;
+};
+
+// English Scrabble (same board as the French game)
+struct EnglishRules {
+    static constexpr std::array<int, 26> LETTER_VALUES = {
+        1, 3, 3, 2, 1, 4, 2, 4, 1, 8, 5, 1, 3, 1, 1, 3, 10, 1, 1, 1, 1, 4, 4, 8, 4, 10};
+
+    static constexpr std::array<int, 27> TILE_COUNTS = {
+        9, 2, 2, 4, 12, 2, 3, 2, 9, 1, 1, 4, 2, 6, 8, 2, 1, 6, 4, 6, 4, 2, 2, 1, 2, 1, 2};
+
+    static constexpr uint32_t VOWELS = detail::letterBits("AEIOU");
+
+    static constexpr const PremiumLayout& LAYOUT = STANDARD_LAYOUT;
+    static constexpr int BINGO_BONUS = 50;
+};
+
+// Total number of tiles in a rule set's bag
+template <typename RuleSet>
+constexpr int tileTotal() {
+    int total = 0;
+    for (int count : RuleSet::TILE_COUNTS) {
+        total += count;
+    }
+    return total;
+}
+
+static_assert(tileTotal<FrenchRules>() == 102, "The French bag holds 102 tiles");
+static_assert(tileTotal<EnglishRules>() == 100, "The English bag holds 100 tiles");
+
+// The rule set the engine is built for: `make RULES=english` builds the
+// English game, anything else the French one. A custom rule set is a struct
+// like the ones above, selected here.
+#if defined(SCRADLE_RULES_ENGLISH)
+using Rules = EnglishRules;
+#else
+using Rules = FrenchRules;
+#endif
+
+}  // namespace scradle
+
+#endif  // SCRADLE_RULE_SET_H
@@ -3,30 +3,43 @@
 
 #include "board.h"
 #include "move.h"
-#include <unordered_map>
+#include "rule_set.h"
+#include <array>
 
 namespace scradle {
 
 // Handles scoring of Scrabble moves
 class Scorer {
 public:
-    Scorer();
-
     // Score a complete move on the board
     int scoreMove(const Board& board, const Move& move) const;
 
-    // Get the value of a single letter
-    int getLetterValue(char letter) const;
+    // Get the value of a single letter (either case; blanks '?' and unknown
+    // characters are worth 0)
+    static int getLetterValue(char letter) {
+        unsigned char c = static_cast<unsigned char>(letter) & ~0x20;  // Upper case
+        return c >= 'A' && c <= 'Z' ? LETTER_VALUES[c - 'A'] : 0;
+    }
+
+    // Letter values indexed by letter - 'A', for code that scores tile by
+    // tile (cross-check sums, the move generator's running score)
+    static const std::array<int, 26>& letterValues() { return LETTER_VALUES; }
+
+    // Letter and word multipliers of a premium square
+    static constexpr int letterMultiplier(PremiumType premium) {
+        return premium == PremiumType::DOUBLE_LETTER ? 2 : premium == PremiumType::TRIPLE_LETTER ? 3 : 1;
+    }
+    static constexpr int wordMultiplier(PremiumType premium) {
+        return premium == PremiumType::DOUBLE_WORD ? 2 : premium == PremiumType::TRIPLE_WORD ? 3 : 1;
+    }
 
     // Constants
-    static constexpr int BINGO_BONUS = 50;  // Bonus for using all 7 tiles
-
-private:
-    std::unordered_map<char, int> letter_values_;
+    static constexpr int BINGO_BONUS = Rules::BINGO_BONUS;  // Bonus for using all 7 tiles
 
-    // Initialize French Scrabble letter values
-    void initializeLetterValues();
+    // Letter values of the rule set the engine is built for
+    static constexpr std::array<int, 26> LETTER_VALUES = Rules::LETTER_VALUES;
 
+private:
     // Calculate score for the main word
     int scoreMainWord(const Board& board, const Move& move) const;
 
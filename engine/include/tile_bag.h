@@ -1,19 +1,22 @@
 #ifndef SCRADLE_TILE_BAG_H
 #define SCRADLE_TILE_BAG_H
 
+#include <cstdint>
 #include <random>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "rule_set.h"
+
 namespace scradle {
 
 // Manages the bag of tiles for a Scrabble game
 class TileBag {
    public:
-    // French Scrabble has 100 tiles total
-    static constexpr int TOTAL_TILES = 100;
+    // Tiles in a full bag (102 in French Scrabble, 100 in English)
+    static constexpr int TOTAL_TILES = tileTotal<Rules>();
 
     // Constructor with optional seed (default uses random_device)
     explicit TileBag(unsigned int seed = 0);
@@ -32,6 +35,9 @@ class TileBag {
     int remainingCount() const { return tiles_.size(); }
     bool isEmpty() const { return tiles_.empty(); }
 
+    // Zobrist hash of the tiles left (see zobrist.h)
+    uint64_t hash() const { return hash_; }
+
     // Statistics
     int vowelCount() const;
     int consonantCount() const;
@@ -52,9 +58,11 @@ class TileBag {
     // Get current state for debugging
     std::string toString() const;
 
-    // Helpers to check letter types
+    // Helpers to check letter types (vowels as the rule set defines them)
     // Blanks ('?') count as both vowel and consonant
-    static bool isVowel(char letter);
+    static bool isVowel(char letter) {
+        return letter == '?' || (letter >= 'A' && letter <= 'Z' && (Rules::VOWELS >> (letter - 'A') & 1));
+    }
     static bool isConsonant(char letter);
 
     // Game state potential utilities
@@ -66,9 +74,14 @@ class TileBag {
     std::multiset<char> tiles_;
     std::mt19937 rng_;
     unsigned int seed_;
+    uint64_t hash_;
 
-    // Initialize the bag with French Scrabble distribution
+    // Initialize the bag with the rule set's distribution
     void initializeTiles();
+
+    // Add or remove one tile, keeping hash_ up to date
+    void insertTile(char tile);
+    void eraseTile(std::multiset<char>::iterator it);
 };
 
 }  // namespace scradle
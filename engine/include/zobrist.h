@@ -0,0 +1,101 @@
+#ifndef SCRADLE_ZOBRIST_H
+#define SCRADLE_ZOBRIST_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "rule_set.h"
+
+namespace scradle {
+
+// Zobrist keys, fixed at compile time: one random 64-bit key per letter on
+// each board square, and per copy of each tile in a rack or in the bag. The
+// hash of a board, rack or bag is the XOR of the keys of what it holds, so
+// Board, Rack and TileBag update theirs with one XOR per tile placed, drawn
+// or returned. Racks and bags hash as multisets: the n-th copy of a tile has
+// its own key, whatever the order of the tiles. The tables cover as many
+// copies as the whole bag holds tiles; keys of further copies (racks built
+// from arbitrary strings) are derived from the table's, so they never wrap.
+namespace zobrist {
+
+inline constexpr int SQUARES = 15 * 15;
+inline constexpr int LETTERS = 52;  // 'A'-'Z', then blanks 'a'-'z'
+inline constexpr int TILES = 27;    // 'A'-'Z', then '?'
+inline constexpr int COPIES = tileTotal<Rules>();  // Copies with a key in the tables
+
+namespace detail {
+
+constexpr uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+template <size_t N>
+constexpr std::array<uint64_t, N> makeKeys(uint64_t seed) {
+    std::array<uint64_t, N> keys{};
+    for (auto& key : keys) {
+        key = splitMix64(seed);
+    }
+    return keys;
+}
+
+// Key of a copy past the tables, mixed from the key of the tile's first copy
+constexpr uint64_t extraKey(uint64_t first_key, int copy) {
+    uint64_t state = first_key ^ static_cast<uint64_t>(copy) * 0xd6e8feb86659fd93ull;
+    return splitMix64(state);
+}
+
+}  // namespace detail
+
+inline constexpr auto SQUARE_KEYS = detail::makeKeys<SQUARES * LETTERS>(0x5eed0001);
+inline constexpr auto RACK_KEYS = detail::makeKeys<TILES * COPIES>(0x5eed0002);
+inline constexpr auto BAG_KEYS = detail::makeKeys<TILES * COPIES>(0x5eed0003);
+
+template <typename RuleSet>
+constexpr bool keysCoverBag() {
+    for (int count : RuleSet::TILE_COUNTS) {
+        if (count > COPIES) return false;
+    }
+    return true;
+}
+static_assert(keysCoverBag<Rules>(), "Every copy of a tile in the bag needs its own key");
+
+// Index of a board letter in SQUARE_KEYS, -1 for an empty square
+constexpr int letterIndex(char letter) {
+    if (letter >= 'A' && letter <= 'Z') return letter - 'A';
+    if (letter >= 'a' && letter <= 'z') return 26 + letter - 'a';
+    return -1;
+}
+
+// Index of a rack or bag tile, -1 for anything that is not a tile
+constexpr int tileIndex(char tile) {
+    if (tile >= 'A' && tile <= 'Z') return tile - 'A';
+    return tile == '?' ? 26 : -1;
+}
+
+// Key of `letter` on square `square` (row * 15 + col); 0 for an empty square
+constexpr uint64_t squareKey(int square, char letter) {
+    int index = letterIndex(letter);
+    return index < 0 ? 0 : SQUARE_KEYS[square * LETTERS + index];
+}
+
+// Key of the copy-th (from 0) `tile` in a rack / in the bag
+constexpr uint64_t rackKey(char tile, int copy) {
+    int index = tileIndex(tile);
+    if (index < 0) return 0;
+    return copy < COPIES ? RACK_KEYS[index * COPIES + copy] : detail::extraKey(RACK_KEYS[index * COPIES], copy);
+}
+constexpr uint64_t bagKey(char tile, int copy) {
+    int index = tileIndex(tile);
+    if (index < 0) return 0;
+    return copy < COPIES ? BAG_KEYS[index * COPIES + copy] : detail::extraKey(BAG_KEYS[index * COPIES], copy);
+}
+
+}  // namespace zobrist
+
+}  // namespace scradle
+
+#endif  // SCRADLE_ZOBRIST_H
@@ -1,5 +1,6 @@
 #include "board.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
@@ -12,13 +13,13 @@ using std::stringstream;
 namespace scradle {
 
 Board::Board() {
+    for (auto& lines : lines_) {
+        std::fill(&lines.letters[0][0], &lines.letters[0][0] + SIZE * LINE_STRIDE, ' ');
+        std::fill(lines.occupancy, lines.occupancy + SIZE, 0);
+    }
     initializePremiumSquares();
 }
 
-Cell& Board::getCell(int row, int col) {
-    return cells_[getIndex(row, col)];
-}
-
 const Cell& Board::getCell(int row, int col) const {
     return cells_[getIndex(row, col)];
 }
@@ -28,7 +29,21 @@ char Board::getLetter(int row, int col) const {
 }
 
 void Board::setLetter(int row, int col, char letter) {
-    cells_[getIndex(row, col)].letter = letter;
+    int index = getIndex(row, col);
+    hash_ ^= zobrist::squareKey(index, cells_[index].letter) ^ zobrist::squareKey(index, letter);
+    cells_[index].letter = letter;
+
+    Lines& rows = lines_[static_cast<int>(Direction::HORIZONTAL)];
+    Lines& cols = lines_[static_cast<int>(Direction::VERTICAL)];
+    rows.letters[row][col] = letter;
+    cols.letters[col][row] = letter;
+    if (letter == ' ') {
+        rows.occupancy[row] &= ~(1u << col);
+        cols.occupancy[col] &= ~(1u << row);
+    } else {
+        rows.occupancy[row] |= 1u << col;
+        cols.occupancy[col] |= 1u << row;
+    }
 }
 
 bool Board::isEmpty(int row, int col) const {
@@ -44,49 +59,48 @@ bool Board::isCenterOccupied() const {
 }
 
 bool Board::isBoardEmpty() const {
-    for (const auto& cell : cells_) {
-        if (!cell.isEmpty()) {
-            return false;
-        }
+    uint16_t occupied = 0;
+    for (uint16_t line : lines_[0].occupancy) {
+        occupied |= line;
     }
-    return true;
+    return occupied == 0;
 }
 
 bool Board::isAnchor(int row, int col) const {
-    bool isAnchor = false;
-    if (row > 0) isAnchor |= !isEmpty(row - 1, col);
-    if (row < 14) isAnchor |= !isEmpty(row + 1, col);
-    if (col > 0) isAnchor |= !isEmpty(row, col - 1);
-    if (col < 14) isAnchor |= !isEmpty(row, col + 1);
-    return isAnchor;
+    return (rowAnchors(row) >> col) & 1;
+}
+
+uint16_t Board::rowAnchors(int row) const {
+    // Tiles left and right in the row, then above and below
+    const uint16_t* rows = lines_[static_cast<int>(Direction::HORIZONTAL)].occupancy;
+    uint16_t anchors = (rows[row] << 1) | (rows[row] >> 1);
+    if (row > 0) anchors |= rows[row - 1];
+    if (row < SIZE - 1) anchors |= rows[row + 1];
+    return anchors & LINE_MASK;
+}
+
+uint16_t Board::columnAnchors(int col) const {
+    const uint16_t* cols = lines_[static_cast<int>(Direction::VERTICAL)].occupancy;
+    uint16_t anchors = (cols[col] << 1) | (cols[col] >> 1);
+    if (col > 0) anchors |= cols[col - 1];
+    if (col < SIZE - 1) anchors |= cols[col + 1];
+    return anchors & LINE_MASK;
 }
 
 string Board::getExistingPrefix(const StartPosition& pos) const {
-    string prefix = "";
-    int row = pos.row;
-    int col = pos.col;
-
-    // Walk backwards from the start position collecting letters
-    if (pos.direction == Direction::HORIZONTAL) {
-        // Move left (decrement col)
-        col--;
-        while (col >= 0 && !isEmpty(row, col)) {
-            // Prepend each letter (we're walking backwards)
-            char letter = getLetter(row, col);
-            prefix = string(1, toupper(letter)) + prefix;
-            col--;
-        }
-    } else {  // VERTICAL
-        // Move up (decrement row)
-        row--;
-        while (row >= 0 && !isEmpty(row, col)) {
-            // Prepend each letter (we're walking backwards)
-            char letter = getLetter(row, col);
-            prefix = string(1, toupper(letter)) + prefix;
-            row--;
-        }
+    int index = pos.direction == Direction::HORIZONTAL ? pos.row : pos.col;
+    int at = pos.direction == Direction::HORIZONTAL ? pos.col : pos.row;
+
+    // The prefix runs back from the start position to the last empty square
+    uint32_t gaps = ~lineOccupancy(pos.direction, index) & ((1u << at) - 1);
+    int start = gaps != 0 ? 32 - __builtin_clz(gaps) : 0;
+
+    // Letters only: clearing bit 5 uppercases blanks
+    const char* letters = line(pos.direction, index);
+    string prefix(letters + start, letters + at);
+    for (char& letter : prefix) {
+        letter &= ~0x20;
     }
-
     return prefix;
 }
 
@@ -160,38 +174,11 @@ Board Board::parseBoard(const std::string& ascii) {
 }
 
 void Board::initializePremiumSquares() {
-    // Standard Scrabble premium square layout
-    // Triple Word Score (TW)
-    const int tw_positions[][2] = {
-        {0, 0}, {0, 7}, {0, 14}, {7, 0}, {7, 14}, {14, 0}, {14, 7}, {14, 14}};
-
-    for (const auto& pos : tw_positions) {
-        getCell(pos[0], pos[1]).premium = PremiumType::TRIPLE_WORD;
-    }
-
-    // Double Word Score (DW)
-    const int dw_positions[][2] = {
-        {1, 1}, {2, 2}, {3, 3}, {4, 4}, {1, 13}, {2, 12}, {3, 11}, {4, 10}, {13, 1}, {12, 2}, {11, 3}, {10, 4}, {13, 13}, {12, 12}, {11, 11}, {10, 10}, {7, 7}  // Center square
-    };
-
-    for (const auto& pos : dw_positions) {
-        getCell(pos[0], pos[1]).premium = PremiumType::DOUBLE_WORD;
-    }
-
-    // Triple Letter Score (TL)
-    const int tl_positions[][2] = {
-        {1, 5}, {1, 9}, {5, 1}, {5, 5}, {5, 9}, {5, 13}, {9, 1}, {9, 5}, {9, 9}, {9, 13}, {13, 5}, {13, 9}};
-
-    for (const auto& pos : tl_positions) {
-        getCell(pos[0], pos[1]).premium = PremiumType::TRIPLE_LETTER;
-    }
-
-    // Double Letter Score (DL)
-    const int dl_positions[][2] = {
-        {0, 3}, {0, 11}, {2, 6}, {2, 8}, {3, 0}, {3, 7}, {3, 14}, {6, 2}, {6, 6}, {6, 8}, {6, 12}, {7, 3}, {7, 11}, {8, 2}, {8, 6}, {8, 8}, {8, 12}, {11, 0}, {11, 7}, {11, 14}, {12, 6}, {12, 8}, {14, 3}, {14, 11}};
-
-    for (const auto& pos : dl_positions) {
-        getCell(pos[0], pos[1]).premium = PremiumType::DOUBLE_LETTER;
+    static_assert(PremiumLayout::SIZE == SIZE, "Premium layout must match the board");
+    for (int row = 0; row < SIZE; row++) {
+        for (int col = 0; col < SIZE; col++) {
+            cells_[getIndex(row, col)].premium = Rules::LAYOUT.at(row, col);
+        }
     }
 }
 
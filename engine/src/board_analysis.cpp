@@ -0,0 +1,126 @@
+#include "board_analysis.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "scorer.h"
+
+using std::min;
+using std::vector;
+
+namespace scradle {
+
+namespace {
+
+// Extensions of a start position at square `start` of a row or column, from
+// the line's occupancy and anchor masks: min_ext is the number of squares up
+// to the first anchor within a rack's reach (1 when a tile follows directly),
+// max_ext the number of empty squares up to the edge. False when no move can
+// start there.
+bool lineExtensions(uint16_t occupied, uint16_t anchors, int start, int& min_ext, int& max_ext) {
+    if ((occupied >> (start + 1)) & 1) {
+        min_ext = 1;
+    } else {
+        uint32_t reach = (anchors >> start) & 0x7F;
+        if (reach == 0) {
+            return false;
+        }
+        min_ext = __builtin_ctz(reach) + 1;
+    }
+    max_ext = __builtin_popcount(~occupied & (Board::LINE_MASK << start) & Board::LINE_MASK);
+    return max_ext >= min_ext;
+}
+
+}  // namespace
+
+BoardAnalysis::BoardAnalysis(const Board& board, const DAWG& dawg, const CrossChecks* cross_checks)
+    : board_(board), dawg_(dawg), cross_checks_(cross_checks) {
+    if (cross_checks_ == nullptr) {
+        owned_cross_checks_.compute(board_, dawg_);
+        cross_checks_ = &owned_cross_checks_;
+    }
+
+    findStartPositions(board_, positions_);
+    prefixes_.reserve(positions_.size());
+    for (const auto& pos : positions_) {
+        prefixes_.push_back(readPrefix(board_, dawg_, pos));
+    }
+
+    findAnchors(board_, *cross_checks_, anchors_);
+}
+
+void BoardAnalysis::findStartPositions(const Board& board, vector<StartPosition>& positions) {
+    positions.clear();
+
+    if (board.isBoardEmpty()) {
+        for (int row = 1; row <= 7; row++) {
+            positions.emplace_back(row, 7, Direction::VERTICAL, 7 - row + 1, 7);
+        }
+        for (int col = 1; col <= 7; col++) {
+            positions.emplace_back(7, col, Direction::HORIZONTAL, 7 - col + 1, 7);
+        }
+        return;
+    }
+
+    // Anchors along each column, for the vertical positions
+    uint16_t column_anchors[Board::SIZE];
+    for (int col = 0; col < Board::SIZE; col++) {
+        column_anchors[col] = board.columnAnchors(col);
+    }
+
+    int min_ext, max_ext;
+    for (int row = 0; row < Board::SIZE; row++) {
+        uint16_t row_anchors = board.rowAnchors(row);
+        // Only empty squares can be start positions
+        uint16_t empty = ~board.rowOccupancy(row) & Board::LINE_MASK;
+        for (; empty != 0; empty &= empty - 1) {
+            int col = __builtin_ctz(empty);
+
+            if (lineExtensions(board.columnOccupancy(col), column_anchors[col], row, min_ext, max_ext)) {
+                positions.emplace_back(row, col, Direction::VERTICAL, min_ext, min(max_ext, 7));
+            }
+            if (lineExtensions(board.rowOccupancy(row), row_anchors, col, min_ext, max_ext)) {
+                positions.emplace_back(row, col, Direction::HORIZONTAL, min_ext, min(max_ext, 7));
+            }
+        }
+    }
+}
+
+BoardAnalysis::Prefix BoardAnalysis::readPrefix(const Board& board, const DAWG& dawg, const StartPosition& pos) {
+    Prefix prefix;
+    prefix.node = dawg.cursorAt(board.getExistingPrefix(pos));
+
+    // Tiles already on the board get no premium; blanks (lowercase) score 0
+    prefix.board_sum = 0;
+    int row = pos.direction == Direction::VERTICAL ? pos.row - 1 : pos.row;
+    int col = pos.direction == Direction::HORIZONTAL ? pos.col - 1 : pos.col;
+    while (board.isValidPosition(row, col) && !board.isEmpty(row, col)) {
+        char letter = board.getLetter(row, col);
+        if (std::isupper(static_cast<unsigned char>(letter))) {
+            prefix.board_sum += Scorer::letterValues()[letter - 'A'];
+        }
+        if (pos.direction == Direction::VERTICAL) {
+            row--;
+        } else {
+            col--;
+        }
+    }
+    return prefix;
+}
+
+void BoardAnalysis::findAnchors(const Board& board, const CrossChecks& cross_checks, vector<Square>& anchors) {
+    anchors.clear();
+    if (board.isBoardEmpty()) {
+        anchors.push_back(Square{Board::CENTER, Board::CENTER});
+        return;
+    }
+    for (int row = 0; row < Board::SIZE; row++) {
+        for (int col = 0; col < Board::SIZE; col++) {
+            if (cross_checks.isAnchor(row, col)) {
+                anchors.push_back(Square{row, col});
+            }
+        }
+    }
+}
+
+}  // namespace scradle
@@ -0,0 +1,134 @@
+#include "cross_checks.h"
+
+#include <cctype>
+#include <string>
+
+#include "scorer.h"
+
+using std::string;
+
+namespace scradle {
+
+CrossChecks::CrossChecks() {
+    masks_[0].fill(DAWG::LETTER_MASK);
+    masks_[1].fill(DAWG::LETTER_MASK);
+    cross_sums_[0].fill(NO_CROSS_WORD);
+    cross_sums_[1].fill(NO_CROSS_WORD);
+    anchors_.fill(false);
+}
+
+void CrossChecks::compute(const Board& board, const DAWG& dawg) {
+    for (int row = 0; row < Board::SIZE; row++) {
+        computeRow(board, dawg, row);
+    }
+    for (int col = 0; col < Board::SIZE; col++) {
+        computeColumn(board, dawg, col);
+    }
+}
+
+void CrossChecks::update(const Board& board, const DAWG& dawg, Placements placements) {
+    uint32_t rows = 0;
+    uint32_t cols = 0;
+    for (const auto& placement : placements) {
+        rows |= 1u << placement.row;
+        cols |= 1u << placement.col;
+    }
+    for (int row = 0; row < Board::SIZE; row++) {
+        if (rows & (1u << row)) {
+            computeRow(board, dawg, row);
+        }
+    }
+    for (int col = 0; col < Board::SIZE; col++) {
+        if (cols & (1u << col)) {
+            computeColumn(board, dawg, col);
+        }
+    }
+}
+
+void CrossChecks::computeRow(const Board& board, const DAWG& dawg, int row) {
+    // Vertical moves cross the row: their masks depend on it alone
+    for (int col = 0; col < Board::SIZE; col++) {
+        int index = row * Board::SIZE + col;
+        computeSquare(board, dawg, row, col, Direction::VERTICAL);
+        anchors_[index] = board.isEmpty(row, col) && board.isAnchor(row, col);
+    }
+}
+
+void CrossChecks::computeColumn(const Board& board, const DAWG& dawg, int col) {
+    // Horizontal moves cross the column: their masks depend on it alone
+    for (int row = 0; row < Board::SIZE; row++) {
+        int index = row * Board::SIZE + col;
+        computeSquare(board, dawg, row, col, Direction::HORIZONTAL);
+        anchors_[index] = board.isEmpty(row, col) && board.isAnchor(row, col);
+    }
+}
+
+void CrossChecks::computeSquare(const Board& board, const DAWG& dawg, int row, int col, Direction dir) {
+    int index = row * Board::SIZE + col;
+    uint32_t& allowed = masks_[static_cast<int>(dir)][index];
+    int16_t& cross_sum = cross_sums_[static_cast<int>(dir)][index];
+
+    allowed = 0;
+    cross_sum = NO_CROSS_WORD;
+    if (!board.isEmpty(row, col)) {
+        return;
+    }
+
+    // The cross-word runs perpendicular to the move
+    int step_row = (dir == Direction::HORIZONTAL) ? 1 : 0;
+    int step_col = (dir == Direction::HORIZONTAL) ? 0 : 1;
+    const std::array<int, 26>& values = Scorer::letterValues();
+    int sum = 0;
+
+    // Tiles directly before the square (read backwards, then reversed)
+    string prefix;
+    int r = row - step_row;
+    int c = col - step_col;
+    while (board.isValidPosition(r, c) && !board.isEmpty(r, c)) {
+        char letter = board.getLetter(r, c);
+        prefix.insert(prefix.begin(), toupper(letter));
+        sum += std::isupper(letter) ? values[letter - 'A'] : 0;  // Blanks score 0
+        r -= step_row;
+        c -= step_col;
+    }
+
+    // Tiles directly after the square
+    string suffix;
+    r = row + step_row;
+    c = col + step_col;
+    while (board.isValidPosition(r, c) && !board.isEmpty(r, c)) {
+        char letter = board.getLetter(r, c);
+        suffix += toupper(letter);
+        sum += std::isupper(letter) ? values[letter - 'A'] : 0;
+        r += step_row;
+        c += step_col;
+    }
+
+    if (prefix.empty() && suffix.empty()) {
+        allowed = DAWG::LETTER_MASK;  // No cross-word formed
+        return;
+    }
+    cross_sum = static_cast<int16_t>(sum);
+
+    DAWG::Cursor node = dawg.cursorAt(prefix);
+    if (!node.valid()) {
+        return;
+    }
+
+    // Keep each letter whose prefix + letter + suffix is a word
+    uint32_t candidates = node.childMask() & DAWG::LETTER_MASK;
+    while (candidates != 0) {
+        int bit = __builtin_ctz(candidates);
+        candidates &= candidates - 1;
+
+        DAWG::Cursor cursor = node.childByBit(bit);
+        for (size_t i = 0; i < suffix.size() && cursor.valid(); i++) {
+            cursor = cursor.child(suffix[i]);
+        }
+        if (cursor.valid() && cursor.isEndOfWord()) {
+            allowed |= 1u << bit;
+        }
+    }
+}
+
+}  // namespace scradle
@@ -2,60 +2,197 @@
 #include <fstream>
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using std::string;
 using std::vector;
-using std::shared_ptr;
-using std::make_shared;
 using std::ifstream;
 
 namespace scradle {
 
-DAWG::DAWG() : root_(make_shared<Node>()), word_count_(0), node_count_(1) {}
+namespace {
 
-DAWG::~DAWG() {
+// Uppercase copy of a word (the DAWG is case-insensitive)
+string toUpper(const string& word) {
+    string upper_word = word;
+    for (char& c : upper_word) {
+        c = std::toupper(static_cast<unsigned char>(c));
+    }
+    return upper_word;
+}
+
+// Header of the compiled binary format, followed by the node array and
+// then the edge array
+struct BinaryHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t word_count;
+    uint32_t node_count;
+    uint32_t edge_count;
+};
+
+constexpr char BINARY_MAGIC[8] = {'S', 'C', 'R', 'D', 'A', 'W', 'G', '\0'};
+constexpr uint32_t BINARY_VERSION = 2;
+
+static_assert(sizeof(BinaryHeader) % alignof(DAWG::Node) == 0, "Node array must stay aligned");
+static_assert(sizeof(DAWG::Node) % alignof(DAWG::Edge) == 0, "Edge array must stay aligned");
+
+}  // namespace
+
+DAWG::DAWG()
+    : nodes_(nullptr), edges_(nullptr), node_count_(0), edge_count_(0), word_count_(0),
+      mapping_(nullptr), mapping_size_(0) {
     clear();
 }
 
+DAWG::~DAWG() {
+    unmap();
+}
+
 void DAWG::clear() {
-    root_ = make_shared<Node>();
+    unmap();
+    owned_nodes_.assign(1, Node{0, 0, 0, false, 0});
+    owned_edges_.clear();
+    useOwnedStorage();
     word_count_ = 0;
-    node_count_ = 1;
 }
 
-void DAWG::build(const vector<string>& words) {
-    clear();
-    for (const auto& word : words) {
-        insertWord(word);
+void DAWG::useOwnedStorage() {
+    nodes_ = owned_nodes_.data();
+    edges_ = owned_edges_.data();
+    node_count_ = static_cast<uint32_t>(owned_nodes_.size());
+    edge_count_ = static_cast<uint32_t>(owned_edges_.size());
+}
+
+void DAWG::unmap() {
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
     }
 }
 
-void DAWG::insertWord(const string& word) {
-    if (word.empty()) {
-        return;
+// Incremental construction of a minimal DAWG from sorted words (Daciuk et al.)
+//
+// Only the path of the last inserted word is kept mutable. When the next word
+// diverges from it, the nodes below the common prefix can no longer change:
+// they are "frozen" bottom-up, and each one is either replaced by an already
+// frozen equivalent node (same finality, same labelled edges to the same
+// children) or appended to the flat arrays and registered.
+struct DAWG::Builder {
+    struct PendingNode {
+        std::vector<Edge> edges;  // Last edge points to the next pending node
+        bool is_end_of_word = false;
+    };
+
+    DAWG& dawg;
+    std::vector<PendingNode> path;
+    std::unordered_map<string, NodeIndex> registry;
+
+    explicit Builder(DAWG& target) : dawg(target), path(1) {
+        // Slot 0 is reserved for the root, which is frozen last
+        dawg.owned_nodes_.assign(1, Node{0, 0, 0, false, 0});
+        dawg.owned_edges_.clear();
     }
 
-    // Convert to uppercase
-    string upper_word = word;
-    for (char& c : upper_word) {
-        c = std::toupper(static_cast<unsigned char>(c));
+    void addWord(const string& word) {
+        // Length of the prefix shared with the previous word
+        size_t common = 0;
+        while (common < word.size() && common + 1 < path.size() &&
+               path[common].edges.back().letter == word[common]) {
+            common++;
+        }
+
+        freezeDownTo(common);
+
+        for (size_t i = common; i < word.size(); i++) {
+            path[i].edges.push_back(Edge{NO_NODE, word[i], {0, 0, 0}});
+            path.emplace_back();
+        }
+        path.back().is_end_of_word = true;
+    }
+
+    void finish() {
+        freezeDownTo(0);
+
+        // The root is never shared, write it straight into its slot
+        const PendingNode& root = path[0];
+        dawg.owned_nodes_[0] = makeNode(root);
+        dawg.owned_edges_.insert(dawg.owned_edges_.end(), root.edges.begin(), root.edges.end());
+    }
+
+    // Freeze every pending node deeper than `depth`
+    void freezeDownTo(size_t depth) {
+        while (path.size() > depth + 1) {
+            NodeIndex frozen = freeze(path.back());
+            path.pop_back();
+            path.back().edges.back().target = frozen;
+        }
+    }
+
+    // Flat node for a pending node whose edges are appended next
+    Node makeNode(const PendingNode& node) const {
+        uint32_t child_mask = 0;
+        for (const Edge& edge : node.edges) {
+            child_mask |= 1u << letterBit(edge.letter);
+        }
+        return Node{static_cast<uint32_t>(dawg.owned_edges_.size()), child_mask,
+                    static_cast<uint8_t>(node.edges.size()), node.is_end_of_word, 0};
+    }
+
+    NodeIndex freeze(const PendingNode& node) {
+        // Signature: finality followed by every (letter, child) pair
+        string key(1, node.is_end_of_word ? '1' : '0');
+        for (const Edge& edge : node.edges) {
+            key += edge.letter;
+            key.append(reinterpret_cast<const char*>(&edge.target), sizeof(edge.target));
+        }
+
+        auto it = registry.find(key);
+        if (it != registry.end()) {
+            return it->second;
+        }
+
+        NodeIndex index = static_cast<NodeIndex>(dawg.owned_nodes_.size());
+        dawg.owned_nodes_.push_back(makeNode(node));
+        dawg.owned_edges_.insert(dawg.owned_edges_.end(), node.edges.begin(), node.edges.end());
+        registry.emplace(std::move(key), index);
+        return index;
     }
+};
 
-    // Traverse/create nodes for each character
-    shared_ptr<Node> current = root_;
-    for (char c : upper_word) {
-        if (current->children.find(c) == current->children.end()) {
-            current->children[c] = make_shared<Node>();
-            node_count_++;
+void DAWG::build(const vector<string>& words) {
+    // Normalize, sort and deduplicate: the minimization needs sorted input
+    vector<string> sorted_words;
+    sorted_words.reserve(words.size());
+    for (const auto& word : words) {
+        if (!word.empty()) {
+            sorted_words.push_back(toUpper(word));
         }
-        current = current->children[c];
     }
+    std::sort(sorted_words.begin(), sorted_words.end());
+    sorted_words.erase(std::unique(sorted_words.begin(), sorted_words.end()), sorted_words.end());
+
+    unmap();
 
-    // Mark end of word
-    if (!current->is_end_of_word) {
-        current->is_end_of_word = true;
-        word_count_++;
+    Builder builder(*this);
+    for (const auto& word : sorted_words) {
+        builder.addWord(word);
     }
+    builder.finish();
+    word_count_ = static_cast<int>(sorted_words.size());
+
+    owned_nodes_.shrink_to_fit();
+    owned_edges_.shrink_to_fit();
+    useOwnedStorage();
 }
 
 bool DAWG::loadFromFile(const string& filename) {
@@ -64,8 +201,7 @@ bool DAWG::loadFromFile(const string& filename) {
         return false;
     }
 
-    clear();
-
+    vector<string> words;
     string word;
     while (std::getline(file, word)) {
         // Trim whitespace
@@ -73,103 +209,184 @@ bool DAWG::loadFromFile(const string& filename) {
         word.erase(word.find_last_not_of(" \t\r\n") + 1);
 
         if (!word.empty() && word[0] != '#') {  // Skip comments
-            insertWord(word);
+            words.push_back(word);
         }
     }
 
     file.close();
+    build(words);
     return true;
 }
 
-bool DAWG::contains(const string& word) const {
-    if (word.empty()) {
+bool DAWG::saveBinary(const string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
         return false;
     }
 
-    shared_ptr<Node> node = getNodeAt(word);
-    return node != nullptr && node->is_end_of_word;
+    BinaryHeader header;
+    std::memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+    header.version = BINARY_VERSION;
+    header.word_count = static_cast<uint32_t>(word_count_);
+    header.node_count = node_count_;
+    header.edge_count = edge_count_;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(nodes_), node_count_ * sizeof(Node));
+    file.write(reinterpret_cast<const char*>(edges_), edge_count_ * sizeof(Edge));
+    return file.good();
 }
 
-bool DAWG::hasPrefix(const string& prefix) const {
-    if (prefix.empty()) {
-        return true;
+bool DAWG::loadMapped(const string& filename) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
     }
 
-    // Convert to uppercase
-    string upper_prefix = prefix;
-    for (char& c : upper_prefix) {
-        c = std::toupper(static_cast<unsigned char>(c));
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(BinaryHeader)) {
+        close(fd);
+        return false;
     }
 
-    // Traverse the DAWG
-    shared_ptr<Node> current = root_;
-    for (char c : upper_prefix) {
-        auto it = current->children.find(c);
-        if (it == current->children.end()) {
-            return false;
-        }
-        current = it->second;
+    size_t size = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping stays valid after the descriptor is closed
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    // Validate the header before trusting any offset in the file
+    const BinaryHeader* header = static_cast<const BinaryHeader*>(mapping);
+    size_t expected_size = sizeof(BinaryHeader) + size_t(header->node_count) * sizeof(Node) +
+                           size_t(header->edge_count) * sizeof(Edge);
+    if (std::memcmp(header->magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0 ||
+        header->version != BINARY_VERSION || header->node_count == 0 || size != expected_size) {
+        munmap(mapping, size);
+        return false;
+    }
+
+    // Check every index once, so traversal never leaves the arrays
+    const char* data = static_cast<const char*>(mapping);
+    const Node* nodes = reinterpret_cast<const Node*>(data + sizeof(BinaryHeader));
+    const Edge* edges = reinterpret_cast<const Edge*>(data + sizeof(BinaryHeader) + header->node_count * sizeof(Node));
+    string error = validateArrays(nodes, header->node_count, edges, header->edge_count);
+    if (!error.empty()) {
+        munmap(mapping, size);
+        throw std::runtime_error("Corrupt compiled dictionary " + filename + ": " + error);
     }
 
+    // Switch over to the mapped arrays
+    clear();
+    owned_nodes_ = vector<Node>();
+    owned_edges_ = vector<Edge>();
+
+    nodes_ = nodes;
+    edges_ = edges;
+    node_count_ = header->node_count;
+    edge_count_ = header->edge_count;
+    word_count_ = static_cast<int>(header->word_count);
+    mapping_ = mapping;
+    mapping_size_ = size;
     return true;
 }
 
-vector<string> DAWG::getWordsWithPrefix(const string& prefix) const {
-    vector<string> results;
+string DAWG::validateArrays(const Node* nodes, uint32_t node_count, const Edge* edges, uint32_t edge_count) {
+    for (uint32_t i = 0; i < node_count; i++) {
+        const Node& node = nodes[i];
+        if (size_t(node.first_edge) + node.edge_count > edge_count) {
+            return "edges of node " + std::to_string(i) + " run past the edge array";
+        }
+        // getChildByBit finds an edge by the rank of its bit in the mask
+        if ((node.child_mask >> (SEPARATOR_BIT + 1)) != 0 ||
+            __builtin_popcount(node.child_mask) != node.edge_count) {
+            return "child mask of node " + std::to_string(i) + " does not match its edges";
+        }
+    }
+    for (uint32_t i = 0; i < edge_count; i++) {
+        if (edges[i].target >= node_count) {
+            return "edge " + std::to_string(i) + " points past the node array";
+        }
+    }
+    return "";
+}
 
-    // Convert to uppercase
-    string upper_prefix = prefix;
-    for (char& c : upper_prefix) {
-        c = std::toupper(static_cast<unsigned char>(c));
+bool DAWG::loadDictionary(const string& compiled, const string& word_list) {
+    // A compiled file older than the word list would shadow its changes
+    struct stat compiled_info;
+    struct stat list_info;
+    bool have_compiled = stat(compiled.c_str(), &compiled_info) == 0;
+    if (have_compiled && stat(word_list.c_str(), &list_info) == 0 &&
+        list_info.st_mtime > compiled_info.st_mtime) {
+        std::cerr << "Warning: " << word_list << " is newer than " << compiled
+                  << ", loading the word list (run make compile-dictionary)" << std::endl;
+        have_compiled = false;
     }
 
-    // Find the node corresponding to the prefix
-    shared_ptr<Node> current = root_;
-    for (char c : upper_prefix) {
-        auto it = current->children.find(c);
-        if (it == current->children.end()) {
-            return results;  // Prefix not found
+    if (have_compiled) {
+        try {
+            if (loadMapped(compiled)) {
+                return true;
+            }
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Warning: " << e.what() << ", loading the word list" << std::endl;
         }
-        current = it->second;
+    }
+    return loadFromFile(word_list);
+}
+
+bool DAWG::contains(const string& word) const {
+    if (word.empty()) {
+        return false;
+    }
+
+    NodeIndex node = getNodeAt(word);
+    return node != NO_NODE && isEndOfWord(node);
+}
+
+bool DAWG::hasPrefix(const string& prefix) const {
+    if (prefix.empty()) {
+        return true;
+    }
+
+    return getNodeAt(prefix) != NO_NODE;
+}
+
+vector<string> DAWG::getWordsWithPrefix(const string& prefix) const {
+    vector<string> results;
+
+    // Find the node corresponding to the prefix
+    NodeIndex node = getNodeAt(prefix);
+    if (node == NO_NODE) {
+        return results;  // Prefix not found
     }
 
     // Collect all words from this node
-    collectWords(current, upper_prefix, results);
+    collectWords(node, toUpper(prefix), results);
 
     return results;
 }
 
-void DAWG::collectWords(const shared_ptr<Node>& node,
+void DAWG::collectWords(NodeIndex node,
                         const string& prefix,
                         vector<string>& results) const {
-    if (node->is_end_of_word) {
+    if (isEndOfWord(node)) {
         results.push_back(prefix);
     }
 
-    for (const auto& pair : node->children) {
-        collectWords(pair.second, prefix + pair.first, results);
+    for (const Edge* edge = edgesBegin(node); edge != edgesEnd(node); ++edge) {
+        collectWords(edge->target, prefix + edge->letter, results);
     }
 }
 
-shared_ptr<DAWG::Node> DAWG::getNodeAt(const string& prefix) const {
-    if (prefix.empty()) {
-        return root_;
-    }
-
-    // Convert to uppercase
-    string upper_prefix = prefix;
-    for (char& c : upper_prefix) {
-        c = std::toupper(static_cast<unsigned char>(c));
-    }
-
+DAWG::NodeIndex DAWG::getNodeAt(const string& prefix) const {
     // Traverse the DAWG
-    shared_ptr<Node> current = root_;
-    for (char c : upper_prefix) {
-        auto it = current->children.find(c);
-        if (it == current->children.end()) {
-            return nullptr;
+    NodeIndex current = getRoot();
+    for (char c : prefix) {
+        current = getChild(current, std::toupper(static_cast<unsigned char>(c)));
+        if (current == NO_NODE) {
+            return NO_NODE;
         }
-        current = it->second;
     }
 
     return current;
@@ -7,7 +7,13 @@
 namespace scradle {
 
 DuplicateGame::DuplicateGame(const DAWG& dawg, unsigned int seed)
-    : dawg_(dawg), state_(seed), scorer_(), rng_(seed) {}
+    : dawg_(dawg),
+      state_(seed),
+      move_gen_(state_.getBoard(), state_.getRack(), dawg_),
+      scorer_(),
+      rng_(seed) {
+    state_.setDictionary(dawg_);
+}
 
 void DuplicateGame::playGame(bool from_start, bool display) {
     // Initialize game
@@ -47,11 +53,11 @@ bool DuplicateGame::playNextMove() {
 
 bool DuplicateGame::findAndPlayBestMove(bool display) {
     // Generate and get best move (already scored)
-    MoveGenerator move_gen(state_.getBoard(), state_.getRack(), dawg_);
+    move_gen_.reset(state_.getBoard(), state_.getRack(), state_.getCrossChecks());
     if (display) {
         std::cout << "Move " << state_.getMoveCount() + 1 << ": rack=" << state_.getRack().toString();
     }
-    std::vector<Move> best_moves = move_gen.getBestMove();
+    std::vector<Move> best_moves = move_gen_.getBestMove();
 
     if (best_moves.empty()) {
         return false;
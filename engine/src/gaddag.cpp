@@ -0,0 +1,56 @@
+#include "gaddag.h"
+
+#include <algorithm>
+#include <fstream>
+
+using std::string;
+using std::vector;
+
+namespace scradle {
+
+void GADDAG::build(const vector<string>& words) {
+    vector<string> paths;
+    for (const auto& word : words) {
+        // Split after each letter: reversed prefix, separator, suffix
+        for (size_t split = 1; split <= word.size(); split++) {
+            string path(word.rend() - split, word.rend());
+            if (split < word.size()) {
+                path += SEPARATOR;
+                path.append(word, split, string::npos);
+            }
+            paths.push_back(std::move(path));
+        }
+    }
+
+    // The DAWG normalizes case, sorts and minimizes the paths
+    graph_.build(paths);
+}
+
+bool GADDAG::loadFromFile(const string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    vector<string> words;
+    string word;
+    while (std::getline(file, word)) {
+        // Trim whitespace
+        word.erase(0, word.find_first_not_of(" \t\r\n"));
+        word.erase(word.find_last_not_of(" \t\r\n") + 1);
+
+        if (!word.empty() && word[0] != '#') {  // Skip comments
+            words.push_back(word);
+        }
+    }
+
+    file.close();
+    build(words);
+    return true;
+}
+
+bool GADDAG::contains(const string& word) const {
+    return !word.empty() && graph_.contains(string(word.rbegin(), word.rend()));
+}
+
+}  // namespace scradle
@@ -2,12 +2,23 @@
 #include "move_generator.h"
 
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 namespace scradle {
 
 GameState::GameState(unsigned int seed)
-    : board_(), rack_(), tile_bag_(seed), seed_(seed), total_score_(0), bingo_count_(0), move_history_() {}
+    : board_(), rack_(), tile_bag_(seed), seed_(seed), dictionary_(nullptr), cross_checks_(),
+      total_score_(0), bingo_count_(0), move_history_(), move_scores_(), move_gen_(), move_gen_dawg_(nullptr) {}
+
+GameState::~GameState() = default;
+GameState::GameState(GameState&&) noexcept = default;
+GameState& GameState::operator=(GameState&&) noexcept = default;
+
+void GameState::setDictionary(const DAWG& dawg) {
+    dictionary_ = &dawg;
+    cross_checks_.compute(board_, dawg);
+}
 
 void GameState::applyMove(const Move& move) {
     // Place tiles on board
@@ -18,6 +29,9 @@ void GameState::applyMove(const Move& move) {
             rack_.removeTile(placement.is_blank ? '?' : placement.letter);
         }
     }
+    if (dictionary_) {
+        cross_checks_.update(board_, *dictionary_, move.getPlacements());
+    }
 
     // Update statistics
     total_score_ += move.getScore();
@@ -26,7 +40,8 @@ void GameState::applyMove(const Move& move) {
     }
 
     // Add to move history
-    move_history_.push_back(move);
+    move_history_.push_back(MoveCode::encode(move));
+    move_scores_.push_back(move.getScore());
 }
 
 void GameState::undoLastMove() {
@@ -34,8 +49,8 @@ void GameState::undoLastMove() {
         return; // Nothing to undo
     }
 
-    // Get the last move
-    const Move& last_move = move_history_.back();
+    // The last move's rack tiles
+    const Move last_move = move_history_.back().decode();
 
     // Remove tiles from board and return them to rack
     for (const auto& placement : last_move.getPlacements()) {
@@ -46,15 +61,34 @@ void GameState::undoLastMove() {
             rack_.addTile(placement.is_blank ? '?' : placement.letter);
         }
     }
+    if (dictionary_) {
+        cross_checks_.update(board_, *dictionary_, last_move.getPlacements());
+    }
 
     // Update statistics
-    total_score_ -= last_move.getScore();
+    total_score_ -= move_scores_.back();
     if (last_move.isBingo()) {
         bingo_count_--;
     }
 
     // Remove from move history
     move_history_.pop_back();
+    move_scores_.pop_back();
+}
+
+std::vector<Move> GameState::getMoveHistory() const {
+    std::vector<Move> moves;
+    moves.reserve(move_history_.size());
+    for (size_t i = 0; i < move_history_.size(); ++i) {
+        moves.push_back(historyMove(i));
+    }
+    return moves;
+}
+
+Move GameState::historyMove(size_t index) const {
+    Move move = move_history_[index].decode(board_);
+    move.setScore(move_scores_[index]);
+    return move;
 }
 
 void GameState::refillRack() {
@@ -84,12 +118,19 @@ void GameState::refillRack() {
 }
 
 bool GameState::findAndPlayBestMove(const DAWG& dawg, bool display) {
-    // Generate and get best move (already scored)
-    MoveGenerator move_gen(getBoard(), getRack(), dawg);
+    // Generate and get best move (already scored), reusing this state's
+    // generator while the dictionary stays the same
+    const CrossChecks* cross_checks = dictionary_ == &dawg ? getCrossChecks() : nullptr;
+    if (move_gen_ == nullptr || move_gen_dawg_ != &dawg) {
+        move_gen_ = std::make_unique<MoveGenerator>(board_, rack_, dawg, cross_checks);
+        move_gen_dawg_ = &dawg;
+    } else {
+        move_gen_->reset(board_, rack_, cross_checks);
+    }
     if (display) {
         std::cout << "Move " << getMoveCount() + 1 << ": rack=" << getRack().toString();
     }
-    std::vector<Move> best_moves = move_gen.getBestMove();
+    std::vector<Move> best_moves = move_gen_->getBestMove();
 
     if (best_moves.empty()) {
         return false;
@@ -160,6 +201,10 @@ void GameState::reset() {
     total_score_ = 0;
     bingo_count_ = 0;
     move_history_.clear();
+    move_scores_.clear();
+    if (dictionary_) {
+        cross_checks_.compute(board_, *dictionary_);
+    }
 }
 
 void GameState::printSummary() const {
@@ -172,7 +217,7 @@ void GameState::printSummary() const {
     if (!move_history_.empty()) {
         std::cout << "Move History:\n";
         for (size_t i = 0; i < move_history_.size(); ++i) {
-            const Move& move = move_history_[i];
+            const Move move = historyMove(i);
             std::cout << (i + 1) << ". " << move.toString() << std::endl;
         }
     }
@@ -194,7 +239,7 @@ std::string GameState::toString() const {
     if (!move_history_.empty()) {
         ss << "Move History:\n";
         for (size_t i = 0; i < move_history_.size(); ++i) {
-            const Move& move = move_history_[i];
+            const Move move = historyMove(i);
             ss << (i + 1) << ". " << move.toString() << std::endl;
         }
     }
@@ -1,6 +1,9 @@
 #include "move.h"
 
+#include <algorithm>
 #include <sstream>
+#include <stdexcept>
+#include <type_traits>
 
 using std::string;
 
@@ -8,18 +11,35 @@ namespace scradle {
 
 const char* row_labels = "ABCDEFGHIJKLMNO";
 
+static_assert(std::is_trivially_copyable<Move>::value, "Moves are copied around in bulk");
+
 Move::Move()
-    : start_row_(0), start_col_(0), direction_(Direction::HORIZONTAL), word_(""), score_(0) {}
+    : start_row_(0), start_col_(0), direction_(Direction::HORIZONTAL), word_length_(0), placement_count_(0),
+      score_(0) {}
 
 Move::Move(int start_row, int start_col, Direction dir, const std::string& word)
-    : start_row_(start_row), start_col_(start_col), direction_(dir), word_(word), score_(0) {}
+    : start_row_(static_cast<int8_t>(start_row)),
+      start_col_(static_cast<int8_t>(start_col)),
+      direction_(dir),
+      word_length_(0),
+      placement_count_(0),
+      score_(0) {
+    if (word.size() > static_cast<size_t>(MAX_LENGTH)) {
+        throw std::runtime_error("Move word longer than the board: " + word);
+    }
+    word_length_ = static_cast<int8_t>(word.size());
+    std::copy(word.begin(), word.end(), word_);
+}
 
 void Move::addPlacement(const TilePlacement& placement) {
-    placements_.push_back(placement);
+    if (placement_count_ >= MAX_LENGTH) {
+        throw std::runtime_error("Move has more placements than the board has squares in a line");
+    }
+    placements_[placement_count_++] = placement;
 }
 
 bool Move::isValid() const {
-    return !word_.empty() && !placements_.empty();
+    return word_length_ > 0 && placement_count_ > 0;
 }
 
 bool Move::isBingo() const {
@@ -37,13 +57,13 @@ std::string Move::toString() const {
     std::stringstream ss;
 
     // Print the whole word, accounting for blank tiles
-    for (size_t i = 0; i < word_.length(); i++) {
+    for (int i = 0; i < word_length_; i++) {
         // Find if this position has a blank tile
         bool is_blank = false;
         int row = (direction_ == Direction::HORIZONTAL) ? start_row_ : start_row_ + i;
         int col = (direction_ == Direction::HORIZONTAL) ? start_col_ + i : start_col_;
 
-        for (const auto& placement : placements_) {
+        for (const auto& placement : getPlacements()) {
             if (placement.row == row && placement.col == col && placement.is_blank) {
                 is_blank = true;
                 break;
@@ -0,0 +1,72 @@
+#include "move_cache.h"
+
+#include <cstring>
+
+namespace scradle {
+
+static constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+MoveCache::MoveCache(size_t capacity) : capacity_(capacity > 0 ? capacity : 1), hits_(0), misses_(0) {}
+
+MoveCache::Key MoveCache::makeKey(const Board& board, const LetterCounts& letters, int query) {
+    Key key{board.hash(), {}, letters, query};
+    for (int row = 0; row < Board::SIZE; row++) {
+        std::memcpy(&key.board[row * Board::SIZE], board.line(Direction::HORIZONTAL, row), Board::SIZE);
+    }
+    return key;
+}
+
+size_t MoveCache::KeyHash::operator()(const Key& key) const {
+    uint64_t hash = key.board_hash ^ static_cast<uint64_t>(key.query);
+    for (int count : key.letters) {
+        hash ^= static_cast<uint64_t>(count);
+        hash *= FNV_PRIME;
+    }
+    return static_cast<size_t>(hash);
+}
+
+bool MoveCache::lookup(const Board& board, const LetterCounts& letters, int query, std::vector<Move>& moves) {
+    Key key = makeKey(board, letters, query);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        misses_++;
+        return false;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    moves = it->second->second;
+    hits_++;
+    return true;
+}
+
+void MoveCache::store(const Board& board, const LetterCounts& letters, int query, const std::vector<Move>& moves) {
+    Key key = makeKey(board, letters, query);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        it->second->second = moves;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+    if (entries_.size() >= capacity_) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    entries_.emplace_front(key, moves);
+    index_[key] = entries_.begin();
+}
+
+void MoveCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+}
+
+size_t MoveCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+}  // namespace scradle
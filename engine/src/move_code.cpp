@@ -0,0 +1,121 @@
+#include "move_code.h"
+
+#include <cctype>
+#include <stdexcept>
+#include <string>
+
+#include "scorer.h"
+
+namespace scradle {
+
+namespace {
+
+constexpr int LINE_SHIFT = 15;
+constexpr int DIRECTION_SHIFT = 19;
+constexpr int LETTERS_SHIFT = 20;
+constexpr int BLANKS_SHIFT = 55;
+
+}  // namespace
+
+MoveCode MoveCode::encode(const Move& move) {
+    bool vertical = move.getDirection() == Direction::VERTICAL;
+    int line = vertical ? move.getStartCol() : move.getStartRow();
+
+    // Letter and blank flag of each placed square of the line
+    char letters[Board::SIZE] = {};
+    bool blanks[Board::SIZE] = {};
+    uint64_t squares = 0;
+    for (const auto& placement : move.getPlacements()) {
+        if (!placement.is_from_rack) {
+            continue;
+        }
+        int along = vertical ? placement.row : placement.col;
+        int across = vertical ? placement.col : placement.row;
+        char letter = static_cast<char>(std::toupper(static_cast<unsigned char>(placement.letter)));
+        if (across != line || along < 0 || along >= Board::SIZE) {
+            throw std::runtime_error("MoveCode: tile off the move's line");
+        }
+        if (letter < 'A' || letter > 'Z') {
+            throw std::runtime_error("MoveCode: tile is not a letter");
+        }
+        squares |= 1ull << along;
+        letters[along] = letter;
+        blanks[along] = placement.is_blank;
+    }
+    if (__builtin_popcountll(squares) > MAX_TILES) {
+        throw std::runtime_error("MoveCode: more tiles than a rack holds");
+    }
+
+    uint64_t value = squares | static_cast<uint64_t>(line) << LINE_SHIFT |
+                     static_cast<uint64_t>(vertical) << DIRECTION_SHIFT;
+    int tile = 0;
+    for (int along = 0; along < Board::SIZE; along++) {
+        if (squares >> along & 1) {
+            value |= static_cast<uint64_t>(letters[along] - 'A') << (LETTERS_SHIFT + 5 * tile);
+            value |= static_cast<uint64_t>(blanks[along]) << (BLANKS_SHIFT + tile);
+            tile++;
+        }
+    }
+    return MoveCode(value);
+}
+
+Move MoveCode::decode() const {
+    Direction dir = getDirection();
+    int line = getLine();
+    int squares = getSquares();
+    int first = squares == 0 ? 0 : __builtin_ctz(squares);
+
+    std::string letters;
+    for (int tile = 0; tile < getTileCount(); tile++) {
+        letters += static_cast<char>('A' + field(LETTERS_SHIFT + 5 * tile, 5));
+    }
+
+    Move move = dir == Direction::VERTICAL ? Move(first, line, dir, letters) : Move(line, first, dir, letters);
+    int tile = 0;
+    for (int along = 0; along < Board::SIZE; along++) {
+        if (squares >> along & 1) {
+            int row = dir == Direction::VERTICAL ? along : line;
+            int col = dir == Direction::VERTICAL ? line : along;
+            move.addPlacement(TilePlacement(row, col, letters[tile], true, field(BLANKS_SHIFT + tile, 1)));
+            tile++;
+        }
+    }
+    return move;
+}
+
+Move MoveCode::decode(const Board& board) const {
+    Direction dir = getDirection();
+    int line = getLine();
+    int squares = getSquares();
+    if (squares == 0) {
+        return decode();
+    }
+
+    // The word runs through the placed squares and the tiles touching them
+    const char* letters = board.line(dir, line);
+    int start = __builtin_ctz(squares);
+    int end = 31 - __builtin_clz(squares);
+    while (start > 0 && letters[start - 1] != ' ') {
+        start--;
+    }
+    while (end < Board::SIZE - 1 && letters[end + 1] != ' ') {
+        end++;
+    }
+
+    std::string word(letters + start, end - start + 1);
+    for (char& c : word) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+
+    Move move = dir == Direction::VERTICAL ? Move(start, line, dir, word) : Move(line, start, dir, word);
+    const Move tiles = decode();
+    for (const auto& placement : tiles.getPlacements()) {
+        move.addPlacement(placement);
+    }
+    // The scorer tells the move's tiles from the board's by its placements,
+    // so the board after the move scores it as the board before did
+    move.setScore(Scorer().scoreMove(board, move));
+    return move;
+}
+
+}  // namespace scradle
@@ -2,11 +2,17 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <numeric>
+#include <omp.h>
 #include <set>
 
 #include "scorer.h"
 #include "move.h"
+#include "move_cache.h"
 
 using std::min;
 using std::string;
@@ -14,355 +20,955 @@ using std::vector;
 
 namespace scradle {
 
-MoveGenerator::MoveGenerator(const Board& board, const Rack& rack, const DAWG& dawg)
-    : board_(board), rack_(rack), dawg_(dawg) {}
+namespace {
 
-vector<Move> MoveGenerator::generateMoves() {
-    // Step 1: Find all start positions
-    vector<StartPosition> positions = findStartPositions();
+// Order in which the start-position engine emits moves: by start position
+// (first placed tile; vertical before horizontal, and on an empty board all
+// vertical starts before horizontal ones), then by placed tiles in DAWG
+// order (a word before its extensions, a letter before its blank)
+struct StartPositionOrder {
+    bool board_empty;
 
-    // Step 2: Generate all raw moves
-    vector<RawMove> raw_moves = generateRawMoves(positions);
+    bool operator()(const RawMove& a, const RawMove& b) const {
+        return less(a.direction, a.placements.data(), a.placements.size(), b.direction, b.placements.data(),
+                    b.placements.size());
+    }
 
-    // Step 3: Filter and validate moves
-    vector<Move> valid_moves = filterValidMoves(raw_moves);
+    bool operator()(const Move& a, const Move& b) const {
+        return less(a.getDirection(), a.getPlacements().data(), a.getPlacements().size(), b.getDirection(),
+                    b.getPlacements().data(), b.getPlacements().size());
+    }
 
-    return valid_moves;
+    bool less(Direction dir_a, const TilePlacement* a, size_t size_a, Direction dir_b, const TilePlacement* b,
+              size_t size_b) const {
+        int rank_a = dir_a == Direction::VERTICAL ? 0 : 1;
+        int rank_b = dir_b == Direction::VERTICAL ? 0 : 1;
+        if (board_empty && rank_a != rank_b) return rank_a < rank_b;
+        if (a[0].row != b[0].row) return a[0].row < b[0].row;
+        if (a[0].col != b[0].col) return a[0].col < b[0].col;
+        if (rank_a != rank_b) return rank_a < rank_b;
+
+        return std::lexicographical_compare(
+            a, a + size_a, b, b + size_b,
+            [](const TilePlacement& x, const TilePlacement& y) {
+                return x.letter != y.letter ? x.letter < y.letter : (!x.is_blank && y.is_blank);
+            });
+    }
+};
+
+}  // namespace
+
+MoveGenerator::MoveGenerator(const Board& board, const Rack& rack, const DAWG& dawg,
+                             const CrossChecks* cross_checks)
+    : MoveGenerator(board, countLetters(rack.getTiles()), dawg, cross_checks) {}
+
+MoveGenerator::MoveGenerator(const Board& board, const Rack& rack, const DAWG& dawg, const GADDAG& gaddag,
+                             const CrossChecks* cross_checks)
+    : MoveGenerator(board, countLetters(rack.getTiles()), dawg, gaddag, cross_checks) {}
+
+MoveGenerator::MoveGenerator(const Board& board, const LetterCounts& letters, const DAWG& dawg,
+                             const CrossChecks* cross_checks)
+    : board_(&board),
+      letters_(letters),
+      tile_count_(std::accumulate(letters.begin(), letters.end(), 0)),
+      dawg_(dawg),
+      gaddag_(nullptr),
+      threads_(1),
+      cache_(nullptr),
+      analysis_(nullptr),
+      cross_checks_(cross_checks) {}
+
+MoveGenerator::MoveGenerator(const Board& board, const LetterCounts& letters, const DAWG& dawg,
+                             const GADDAG& gaddag, const CrossChecks* cross_checks)
+    : board_(&board),
+      letters_(letters),
+      tile_count_(std::accumulate(letters.begin(), letters.end(), 0)),
+      dawg_(dawg),
+      gaddag_(&gaddag),
+      threads_(1),
+      cache_(nullptr),
+      analysis_(nullptr),
+      cross_checks_(cross_checks) {}
+
+MoveGenerator::MoveGenerator(const BoardAnalysis& analysis, const LetterCounts& letters)
+    : MoveGenerator(analysis.getBoard(), letters, analysis.getDictionary(), &analysis.getCrossChecks()) {
+    analysis_ = &analysis;
 }
 
-vector<Move> MoveGenerator::getBestMove() {
-    vector<Move> valid_moves = generateMoves();
+MoveGenerator::MoveGenerator(const BoardAnalysis& analysis, const LetterCounts& letters, const GADDAG& gaddag)
+    : MoveGenerator(analysis.getBoard(), letters, analysis.getDictionary(), gaddag, &analysis.getCrossChecks()) {
+    analysis_ = &analysis;
+}
 
-    if (valid_moves.empty()) {
-        return valid_moves;
+LetterCounts MoveGenerator::countLetters(const string& tiles) {
+    LetterCounts letters{};
+    for (char c : tiles) {
+        letters[c == '?' ? 26 : c - 'A']++;
     }
+    return letters;
+}
+
+void MoveGenerator::reset(const Board& board, const Rack& rack, const CrossChecks* cross_checks) {
+    reset(board, countLetters(rack.getTiles()), cross_checks);
+}
+
+void MoveGenerator::reset(const Board& board, const LetterCounts& letters, const CrossChecks* cross_checks) {
+    board_ = &board;
+    letters_ = letters;
+    tile_count_ = std::accumulate(letters.begin(), letters.end(), 0);
+    cross_checks_ = cross_checks;
+    analysis_ = nullptr;
+}
+
+void MoveGenerator::reset(const BoardAnalysis& analysis, const LetterCounts& letters) {
+    reset(analysis.getBoard(), letters, &analysis.getCrossChecks());
+    analysis_ = &analysis;
+}
+
+void MoveGenerator::setThreads(int threads) {
+    threads_ = threads;
+}
+
+void MoveGenerator::setCache(MoveCache* cache) {
+    cache_ = cache;
+}
+
+int MoveGenerator::threadCount() const {
+    return threads_ > 0 ? threads_ : omp_get_max_threads();
+}
 
-    // Step 4: Score all moves
-    Scorer scorer;
-    for (auto& move : valid_moves) {
-        int score = scorer.scoreMove(board_, move);
-        move.setScore(score);
+const CrossChecks& MoveGenerator::crossChecks() const {
+    if (cross_checks_ == nullptr) {
+        owned_cross_checks_.compute(*board_, dawg_);
+        cross_checks_ = &owned_cross_checks_;
     }
+    return *cross_checks_;
+}
 
-    // Step 5: Find the best score
-    int best_score = valid_moves[0].getScore();
-    for (const auto& move : valid_moves) {
-        if (move.getScore() > best_score) {
-            best_score = move.getScore();
+vector<Move> MoveGenerator::generateMoves() {
+    // Each thread keeps its moves with the task they came from
+    struct Found {
+        vector<Move> moves;
+        vector<int> tasks;
+    };
+    vector<Found> found(threadCount());
+    visitPerThread(found, [this](Found& state, int task, const MoveView& move) {
+        state.moves.push_back(toMove(move));
+        state.tasks.push_back(task);
+    });
+
+    // A task runs on a single thread: laying the threads' moves out task by
+    // task restores the serial order
+    vector<Move> moves;
+    if (found.size() == 1) {
+        moves = std::move(found[0].moves);
+    } else {
+        int task_count = 0;
+        for (const auto& state : found) {
+            for (int task : state.tasks) {
+                task_count = std::max(task_count, task + 1);
+            }
+        }
+        vector<size_t> offsets(task_count + 1, 0);
+        for (const auto& state : found) {
+            for (int task : state.tasks) {
+                offsets[task + 1]++;
+            }
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        moves.resize(offsets[task_count]);
+        for (auto& state : found) {
+            for (size_t i = 0; i < state.moves.size(); i++) {
+                moves[offsets[state.tasks[i]]++] = std::move(state.moves[i]);
+            }
         }
     }
 
-    // Step 6: Return all moves with the best score
+    // The anchor engine visits moves anchor by anchor
+    if (gaddag_ != nullptr) {
+        sortCanonical(moves);
+    }
+    return moves;
+}
+
+vector<Move> MoveGenerator::getBestMove() {
     vector<Move> best_moves;
-    for (const auto& move : valid_moves) {
-        if (move.getScore() == best_score) {
-            best_moves.push_back(move);
+    if (cache_ != nullptr && cache_->lookup(*board_, letters_, MoveCache::BEST_MOVES, best_moves)) {
+        return best_moves;
+    }
+
+    ScoreBound bound;
+    initScoreBound(bound);
+    bound.best_only = true;
+
+    // Only moves tying the best score so far are materialized; the search
+    // skips whatever cannot reach that score
+    vector<vector<Move>>& found = threadMoves();
+    visitPerThread(found, [this, &bound](vector<Move>& best, int, const MoveView& move) {
+        if (move.score < bound.floor() || (!best.empty() && move.score < best.front().getScore())) {
+            return;
+        }
+        if (!best.empty() && move.score > best.front().getScore()) {
+            best.clear();
+        }
+        best.push_back(toMove(move));
+        bound.raiseFloor(move.score);
+    }, &bound);
+
+    for (auto& best : found) {
+        if (best.empty() || (!best_moves.empty() && best.front().getScore() < best_moves.front().getScore())) {
+            continue;
+        }
+        if (!best_moves.empty() && best.front().getScore() > best_moves.front().getScore()) {
+            best_moves.clear();
         }
+        std::move(best.begin(), best.end(), std::back_inserter(best_moves));
     }
 
+    // Promising positions were searched first
+    sortCanonical(best_moves);
+    if (cache_ != nullptr) {
+        cache_->store(*board_, letters_, MoveCache::BEST_MOVES, best_moves);
+    }
     return best_moves;
 }
 
 vector<Move> MoveGenerator::getTopMoves(int count) {
-    vector<Move> valid_moves = generateMoves();
-
-    if (valid_moves.empty()) {
-        return valid_moves;
+    vector<Move> top_moves;
+    if (count <= 0) {
+        return top_moves;
     }
-
-    // Score all moves
-    Scorer scorer;
-    for (auto& move : valid_moves) {
-        int score = scorer.scoreMove(board_, move);
-        move.setScore(score);
+    if (cache_ != nullptr && cache_->lookup(*board_, letters_, count, top_moves)) {
+        return top_moves;
     }
 
-    // Sort moves by score in descending order
-    std::sort(valid_moves.begin(), valid_moves.end(),
-              [](const Move& a, const Move& b) {
-                  return a.getScore() > b.getScore();
-              });
+    // Higher score first, ties in generateMoves order
+    StartPositionOrder canonical{board_->isBoardEmpty()};
+    auto better = [&canonical](const Move& a, const Move& b) {
+        return a.getScore() != b.getScore() ? a.getScore() > b.getScore() : canonical(a, b);
+    };
+
+    // Bounded heap per thread with the worst kept move on top; once one is
+    // full, its score is a floor every thread's search has to reach
+    ScoreBound bound;
+    initScoreBound(bound);
+    vector<vector<Move>>& heaps = threadMoves();
+    visitPerThread(heaps, [&](vector<Move>& heap, int, const MoveView& view) {
+        if (view.score < bound.floor()) {
+            return;
+        }
+        Move move = toMove(view);
+        if (static_cast<int>(heap.size()) < count) {
+            heap.push_back(std::move(move));
+            std::push_heap(heap.begin(), heap.end(), better);
+        } else if (better(move, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = std::move(move);
+            std::push_heap(heap.begin(), heap.end(), better);
+        } else {
+            return;
+        }
+        if (static_cast<int>(heap.size()) == count) {
+            bound.raiseFloor(heap.front().getScore());
+        }
+    }, &bound);
 
-    // Return top 'count' moves (or all if fewer than count)
-    if (count >= (int)valid_moves.size()) {
-        return valid_moves;
+    for (auto& heap : heaps) {
+        std::move(heap.begin(), heap.end(), std::back_inserter(top_moves));
+    }
+    std::sort(top_moves.begin(), top_moves.end(), better);
+    if (static_cast<int>(top_moves.size()) > count) {
+        top_moves.erase(top_moves.begin() + count, top_moves.end());
+    }
+    if (cache_ != nullptr) {
+        cache_->store(*board_, letters_, count, top_moves);
     }
+    return top_moves;
+}
 
-    return vector<Move>(valid_moves.begin(), valid_moves.begin() + count);
+vector<vector<Move>>& MoveGenerator::threadMoves() {
+    scratch_.moves.resize(threadCount());
+    for (auto& moves : scratch_.moves) {
+        moves.clear();
+    }
+    return scratch_.moves;
 }
 
-vector<StartPosition> MoveGenerator::findStartPositions() const {
-    vector<StartPosition> positions;
+void MoveGenerator::initScoreBound(ScoreBound& bound) const {
+    // No move uses more than a rack's worth of any letter
+    int values[27 * Rack::MAX_TILES] = {};
+    int value_count = 0;
+    for (int c = 0; c < 27; c++) {
+        int value = c < 26 ? Scorer::letterValues()[c] : 0;
+        value_count = std::fill_n(values + value_count, min(letters_[c], Rack::MAX_TILES), value) - values;
+    }
+    std::sort(values, values + value_count, std::greater<int>());
 
-    if (board_.isBoardEmpty()) {
-        for (int row = 1; row <= 7; row++) {
-            positions.emplace_back(row, 7, Direction::VERTICAL, 7 - row + 1, 7);
-        }
-        for (int col = 1; col <= 7; col++) {
-            positions.emplace_back(7, col, Direction::HORIZONTAL, 7 - col + 1, 7);
-        }
-        return positions;
+    bound.top_sums[0] = 0;
+    for (int i = 0; i < Rack::MAX_TILES; i++) {
+        bound.top_sums[i + 1] = bound.top_sums[i] + values[i];
     }
+    bound.best_value = values[0];
+    bound.tile_count = tile_count_;
+    bound.best_only = false;
+    bound.floor_score = 0;
+}
 
-    int cur_row, cur_col, min_ext, max_ext;
-    for (int row = 0; row <= 14; row++) {
-        for (int col = 0; col <= 14; col++) {
-            if (!board_.isEmpty(row, col)) {
-                // cell is not empty, so cannot be a start position
-                continue;
-            }
+Move MoveGenerator::toMove(const MoveView& view) const {
+    // The word runs through the first tile, over board tiles and the placed ones
+    int offset;
+    int start;
+    Line line = lineThrough(view.tiles[0].row, view.tiles[0].col, view.direction, offset);
+    string word = readWord(line, offset, view.tiles, view.tile_count, start);
 
-            // try to extend vertically
-            min_ext = 0;
-
-            // Special case: if there's a tile immediately below, min_ext = 1
-            if (row + 1 <= 14 && !board_.isEmpty(row + 1, col)) {
-                min_ext = 1;
-            } else {
-                // Otherwise, search forward for an anchor
-                for (int cur_ext = 1; cur_ext <= 7; cur_ext++) {
-                    cur_row = row + cur_ext - 1;
-                    if (board_.isAnchor(cur_row, col)) {
-                        min_ext = cur_ext;
-                        break;
-                    }
-                }
-            }
+    Move move(line.row(start), line.col(start), view.direction, word);
+    for (const auto& tile : view) {
+        move.addPlacement(tile);
+    }
+    move.setScore(view.score);
+    return move;
+}
 
-            if (min_ext > 0) {
-                // Found vertical anchor - compute max_ext and add position
-                max_ext = 0;
-                cur_row = row;
-                while (cur_row <= 14) {
-                    if (board_.isEmpty(cur_row, col)) {
-                        max_ext++;
-                    }
-                    cur_row++;
-                }
+vector<StartPosition> MoveGenerator::findStartPositions() const {
+    vector<StartPosition> positions;
+    findStartPositions(positions);
+    return positions;
+}
 
-                if (max_ext >= min_ext) {
-                    positions.emplace_back(row, col, Direction::VERTICAL, min_ext, min(max_ext, 7));
-                }
-            }
+void MoveGenerator::findStartPositions(vector<StartPosition>& positions) const {
+    BoardAnalysis::findStartPositions(*board_, positions);
+}
 
-            // try to extend horizontally
-            min_ext = 0;
-
-            // Special case: if there's a tile immediately to the right, min_ext = 1
-            if (col + 1 <= 14 && !board_.isEmpty(row, col + 1)) {
-                min_ext = 1;
-            } else {
-                // Otherwise, search forward for an anchor
-                for (int cur_ext = 1; cur_ext <= 7; cur_ext++) {
-                    cur_col = col + cur_ext - 1;
-                    if (board_.isAnchor(row, cur_col)) {
-                        min_ext = cur_ext;
-                        break;
-                    }
-                }
-            }
+bool MoveGenerator::countRackLetters(int letter_count[27]) const {
+    std::copy(letters_.begin(), letters_.end(), letter_count);
+    return tile_count_ > 0;
+}
 
-            if (min_ext > 0) {
-                // Found horizontal anchor - compute max_ext and add position
-                max_ext = 0;
-                cur_col = col;
-                while (cur_col <= 14) {
-                    if (board_.isEmpty(row, cur_col)) {
-                        max_ext++;
-                    }
-                    cur_col++;
-                }
+uint32_t MoveGenerator::rackMask(const int letter_count[27]) {
+    uint32_t mask = 0;
+    for (int c = 0; c < 26; c++) {
+        if (letter_count[c] > 0) {
+            mask |= 1u << c;
+        }
+    }
+    return mask;
+}
 
-                if (max_ext >= min_ext) {
-                    positions.emplace_back(row, col, Direction::HORIZONTAL, min_ext, min(max_ext, 7));
-                }
+void MoveGenerator::visitMoves(const TaskSink* sinks, int sink_count, const ScoreBound* bound) const {
+    // Words must be at least 2 letters: a lone tile needs a neighbour along the move
+    auto check = [this](const TaskSink* sink) {
+        return [this, sink](int task, const MoveView& move) {
+            if (move.tile_count > 1 || hasNeighbourAlong(move.tiles[0], move.direction)) {
+                (*sink)(task, move);
             }
+        };
+    };
+    auto search = [this, sink_count, bound](const TaskSink* checked_sinks) {
+        // Built once, before the search threads share it
+        crossChecks();
+
+        if (gaddag_ != nullptr) {
+            visitAnchorMoves(checked_sinks, sink_count, bound);
+        } else if (analysis_ != nullptr) {
+            visitStartPositionMoves(analysis_->getStartPositions(), checked_sinks, sink_count, bound);
+        } else {
+            findStartPositions(scratch_.positions);
+            visitStartPositionMoves(scratch_.positions, checked_sinks, sink_count, bound);
         }
+    };
+
+    // A serial search needs no per-thread arrays
+    if (sink_count == 1) {
+        auto checked = check(sinks);
+        TaskSink checked_sink = makeTaskSink(checked);
+        search(&checked_sink);
+        return;
+    }
+    vector<decltype(check(sinks))> checked;
+    vector<TaskSink> checked_sinks;
+    checked.reserve(sink_count);
+    for (int i = 0; i < sink_count; i++) {
+        checked.push_back(check(&sinks[i]));
+    }
+    for (auto& visitor : checked) {
+        checked_sinks.push_back(makeTaskSink(visitor));
     }
+    search(checked_sinks.data());
+}
 
-    return positions;
+bool MoveGenerator::hasNeighbourAlong(const TilePlacement& tile, Direction dir) const {
+    int offset;
+    Line line = lineThrough(tile.row, tile.col, dir, offset);
+    // Square 15 reads as empty
+    return (offset > 0 && !line.isEmpty(offset - 1)) || !line.isEmpty(offset + 1);
+}
+
+void MoveGenerator::sortCanonical(vector<Move>& moves) const {
+    std::stable_sort(moves.begin(), moves.end(), StartPositionOrder{board_->isBoardEmpty()});
+}
+
+RawMove MoveGenerator::toRawMove(const MoveView& view) {
+    RawMove raw_move;
+    raw_move.placements.assign(view.begin(), view.end());
+    raw_move.direction = view.direction;
+    raw_move.start_row = view.tiles[0].row;
+    raw_move.start_col = view.tiles[0].col;
+    raw_move.score = view.score;
+    return raw_move;
 }
 
 vector<RawMove> MoveGenerator::generateRawMoves(const vector<StartPosition>& positions) const {
     vector<RawMove> raw_moves;
+    auto collect = [&](int, const MoveView& move) { raw_moves.push_back(toRawMove(move)); };
+    TaskSink sink = makeTaskSink(collect);
+    visitStartPositionMoves(positions, &sink, 1);
+    return raw_moves;
+}
 
-    // Get rack tiles as a string
-    string rack_tiles = rack_.toString();
-    if (rack_tiles == "(empty)") {
-        return raw_moves;  // No moves possible with empty rack
+void MoveGenerator::visitStartPositionMoves(const vector<StartPosition>& positions, const TaskSink* sinks,
+                                            int sink_count, const ScoreBound* bound) const {
+    int letter_count[27];
+    if (!countRackLetters(letter_count)) {
+        return;  // No moves possible with empty rack
     }
+    uint32_t rack_mask = rackMask(letter_count);
 
-    // Build letter count array (26 letters + blanks)
-    int letter_count[27] = {0};  // A-Z = 0-25, blank = 26
-    for (char c : rack_tiles) {
-        if (c == '?') {
-            letter_count[26]++;
-        } else {
-            letter_count[c - 'A']++;
+    vector<Start>& starts = scratch_.starts;
+    starts.clear();
+
+    // The analysis has the prefixes of its own positions
+    const BoardAnalysis::Prefix* prefixes =
+        analysis_ != nullptr && &positions == &analysis_->getStartPositions() ? analysis_->getPrefixes().data()
+                                                                                : nullptr;
+
+    for (const auto& pos : positions) {
+        // Existing prefix (tiles before the start position): its DAWG node
+        // and value
+        BoardAnalysis::Prefix prefix = prefixes != nullptr ? prefixes[&pos - positions.data()]
+                                                           : BoardAnalysis::readPrefix(*board_, dawg_, pos);
+
+        // If prefix is not in DAWG, no valid moves can be formed
+        if (!prefix.node.valid()) {
+            continue;
+        }
+
+        // The prefix tiles count toward the main word
+        RunningScore score;
+        score.main_sum = prefix.board_sum;
+
+        starts.push_back(Start{&pos, prefix.node, score, PositionBound(), 0});
+        if (bound != nullptr) {
+            Start& start = starts.back();
+            start.bound.search = bound;
+            boundPosition(pos, start.bound);
+            start.upper_bound = upperBound(score, start.bound.extensions[0]);
         }
     }
 
-    // For each start position, generate moves using DFS
-    for (const auto& pos : positions) {
-        // Get any existing prefix (tiles before the start position)
-        string existing_prefix = board_.getExistingPrefix(pos);
+    // Best-only search: most promising positions first (in board order
+    // among equals), so the best score rises early and the remaining
+    // positions are cut as a whole
+    if (bound != nullptr) {
+        std::sort(starts.begin(), starts.end(), [](const Start& a, const Start& b) {
+            return a.upper_bound != b.upper_bound ? a.upper_bound > b.upper_bound : a.pos < b.pos;
+        });
+    }
 
-        // Find the DAWG node corresponding to this prefix
-        auto start_node = existing_prefix.empty() ? dawg_.getRoot() : dawg_.getNodeAt(existing_prefix);
+    // A task searches one start position; on several threads, one task per
+    // first tile letter, so that heavy positions are shared out too
+    vector<SearchTask>& tasks = scratch_.tasks;
+    tasks.clear();
+    for (int index = 0; index < static_cast<int>(starts.size()); index++) {
+        const Start& start = starts[index];
+        if (sink_count == 1) {
+            tasks.push_back(SearchTask{index, DAWG::LETTER_MASK});
+            continue;
+        }
+        const StartPosition& pos = *start.pos;
+        uint32_t first_letters = start.node.childMask() & (letter_count[26] > 0 ? DAWG::LETTER_MASK : rack_mask) &
+                                 crossChecks().get(pos.row, pos.col, pos.direction);
+        while (first_letters != 0) {
+            int bit = __builtin_ctz(first_letters);
+            first_letters &= first_letters - 1;
+            tasks.push_back(SearchTask{index, 1u << bit});
+        }
+    }
 
-        // If prefix is not in DAWG, no valid moves can be formed
-        if (start_node == nullptr) {
+    int task_count = static_cast<int>(tasks.size());
+#pragma omp parallel for schedule(dynamic, 1) num_threads(sink_count) if (sink_count > 1)
+    for (int task = 0; task < task_count; task++) {
+        const Start& start = starts[tasks[task].item];
+        if (bound != nullptr && start.upper_bound < bound->floor()) {
             continue;
         }
 
+        // The DFS uses and restores its own copy of the rack
+        int task_letters[27];
+        std::copy(letter_count, letter_count + 27, task_letters);
+
         // Create a buffer to hold tiles we're placing from rack
         string tiles_from_rack;
         tiles_from_rack.reserve(7);
+
         // Start DFS from the appropriate DAWG node, position offset 0
-        dfsGenerateMoves(letter_count, start_node, tiles_from_rack, 0, pos, &raw_moves);
+        TaskMoves moves{&sinks[omp_get_thread_num()], task};
+        dfsGenerateMoves(task_letters, rack_mask, start.node, tiles_from_rack, 0, *start.pos, start.score,
+                         makeSink(moves), bound != nullptr ? &start.bound : nullptr, tasks[task].first_letters);
     }
-
-    return raw_moves;
 }
 
 void MoveGenerator::dfsGenerateMoves(
     int letter_count[27],
-    std::shared_ptr<DAWG::Node> node,
+    uint32_t rack_mask,
+    DAWG::Cursor node,
     string& tiles_from_rack,
     int position_offset,
     const StartPosition& pos,
-    vector<RawMove>* raw_moves) const {
+    RunningScore score,
+    const MoveSink& sink,
+    const PositionBound* bound,
+    uint32_t first_letters) const {
+
+    // Current square, `position_offset` squares from the start position
+    int current;
+    Line line = lineThrough(pos.row, pos.col, pos.direction, current);
+    current += position_offset;
+    int current_row = line.row(current);
+    int current_col = line.col(current);
+
+    // The word can only end here if this square is empty or off the board
+    // (otherwise the tiles already on the board belong to the word)
+    bool on_board = current < Board::SIZE;
+    bool word_ends_here = line.isEmpty(current);
 
-    // Calculate current position on the board
-    int current_row = pos.row;
-    int current_col = pos.col;
+    // Count how many tiles we've placed from rack
+    int tiles_placed = tiles_from_rack.size();
+    // If we have placed enough tiles and this is a valid word, save it
+    if (word_ends_here && node.isEndOfWord() &&
+        tiles_placed >= pos.min_extension && tiles_placed <= pos.max_extension) {
+        TilePlacement tiles[Rack::MAX_TILES];
+        MoveView move{pos.direction, finalScore(score, tiles_placed), layoutTiles(tiles_from_rack, pos, tiles), tiles};
+        if (move.tile_count > 0 && bound != nullptr) {
+            visitBlankAssignments(move, sink, bound->search->best_only);
+        } else if (move.tile_count > 0) {
+            sink(move);
+        }
+    }
 
-    // Advance position by position_offset
-    for (int i = 0; i < position_offset; i++) {
-        getNext(current_row, current_col, pos.direction);
+    // Don't extend beyond the board or max_extension tiles from rack
+    if (!on_board || tiles_placed > pos.max_extension) {
+        return;
     }
 
-    // Check if we've gone off the board
-    if (current_row > 15 || current_col > 15) {
+    // Check if there's an existing tile at current position
+    if (!line.isEmpty(current)) {
+        // There's a tile on the board - we must use it
+        char existing_letter = toupper(line.letters[current]);
+        DAWG::Cursor child = node.child(existing_letter);
+        if (child.valid()) {
+            // Continue to next position without placing a tile from rack
+            dfsGenerateMoves(letter_count, rack_mask, child, tiles_from_rack, position_offset + 1, pos,
+                             addBoardTile(score, current_row, current_col), sink, bound, first_letters);
+        }
         return;
     }
 
-    // Count how many tiles we've placed from rack
-    int tiles_placed = tiles_from_rack.size();
-    // If we have placed enough tiles and this is a valid word, save it
-    if (node->is_end_of_word && tiles_placed >= pos.min_extension && tiles_placed <= pos.max_extension) {
-        RawMove raw_move = createRawMove(tiles_from_rack, pos);
-        if (!raw_move.placements.empty()) {
-            raw_moves->push_back(raw_move);
+    // Best-only search: skip the extensions if none can reach the best score
+    if (bound != nullptr && (tiles_placed >= bound->tile_limit ||
+                             upperBound(score, bound->extensions[tiles_placed]) < bound->search->floor())) {
+        return;
+    }
+
+    // Empty square - try each child letter we hold a tile for (any child
+    // letter when a blank is left) that forms valid cross-words here,
+    // in ascending letter order
+    uint32_t candidates = node.childMask() & (letter_count[26] > 0 ? DAWG::LETTER_MASK : rack_mask) &
+                          crossChecks().get(current_row, current_col, pos.direction) &
+                          (position_offset == 0 ? first_letters : DAWG::LETTER_MASK);
+    while (candidates != 0) {
+        int c = __builtin_ctz(candidates);
+        candidates &= candidates - 1;
+        DAWG::Cursor child = node.childByBit(c);
+
+        // First, try using a regular tile
+        if (letter_count[c] > 0) {
+            // Choose this letter (uppercase = regular tile)
+            letter_count[c]--;
+            tiles_from_rack.push_back('A' + c);
+
+            // Recurse (dropping the letter from the mask once it is used up)
+            uint32_t remaining = letter_count[c] > 0 ? rack_mask : rack_mask & ~(1u << c);
+            dfsGenerateMoves(letter_count, remaining, child, tiles_from_rack, position_offset + 1, pos,
+                             addPlacedTile(score, current_row, current_col, pos.direction, c, false), sink, bound,
+                             first_letters);
+
+            // Undo choice
+            tiles_from_rack.pop_back();
+            letter_count[c]++;
+        }
+
+        // Also try using a blank tile for this letter (if we have any).
+        // Bounded searches treat blanks symbolically: a word takes a
+        // letter's regular tiles first and blanks once they run out, all
+        // scored as regular tiles, and visitBlankAssignments then picks the
+        // blank squares
+        if (letter_count[26] > 0 && (bound == nullptr || letter_count[c] == 0)) {
+            // Choose this letter using a blank (lowercase = blank tile)
+            letter_count[26]--;
+            tiles_from_rack.push_back('a' + c);  // lowercase to mark as blank
+
+            // Recurse
+            dfsGenerateMoves(letter_count, rack_mask, child, tiles_from_rack, position_offset + 1, pos,
+                             addPlacedTile(score, current_row, current_col, pos.direction, c, bound == nullptr),
+                             sink, bound, first_letters);
+
+            // Undo choice
+            tiles_from_rack.pop_back();
+            letter_count[26]++;
         }
-    } else {
     }
+}
+
+// ============================================================================
+// Anchor engine (GADDAG)
+// ============================================================================
+
+vector<RawMove> MoveGenerator::generateAnchorRawMoves() const {
+    vector<RawMove> raw_moves;
+    auto collect = [&](int, const MoveView& move) { raw_moves.push_back(toRawMove(move)); };
+    TaskSink sink = makeTaskSink(collect);
+    visitAnchorMoves(&sink, 1);
 
-    // Don't extend beyond max_extension tiles from rack
-    if (tiles_placed > pos.max_extension) {
+    std::sort(raw_moves.begin(), raw_moves.end(), StartPositionOrder{board_->isBoardEmpty()});
+    return raw_moves;
+}
+
+void MoveGenerator::visitAnchorMoves(const TaskSink* sinks, int sink_count, const ScoreBound* bound) const {
+    int letter_count[27];
+    if (gaddag_ == nullptr || !countRackLetters(letter_count)) {
         return;
     }
 
-    // Check if there's an existing tile at current position
-    if (!board_.isEmpty(current_row, current_col)) {
+    uint32_t rack_mask = rackMask(letter_count);
+    const DAWG& graph = gaddag_->getGraph();
+
+    // Anchors in board order, each searched vertically then horizontally
+    const vector<BoardAnalysis::Square>* squares = &scratch_.anchor_squares;
+    if (analysis_ != nullptr) {
+        squares = &analysis_->getAnchors();
+    } else {
+        BoardAnalysis::findAnchors(*board_, crossChecks(), scratch_.anchor_squares);
+    }
+    vector<Anchor>& anchors = scratch_.anchors;
+    anchors.clear();
+    for (const auto& square : *squares) {
+        for (Direction dir : {Direction::VERTICAL, Direction::HORIZONTAL}) {
+            int upper_bound = bound ? anchorUpperBound(square.row, square.col, dir, *bound) : 0;
+            anchors.push_back(Anchor{square.row, square.col, dir, upper_bound});
+        }
+    }
+
+    // Best-only search: most promising anchors first (in board order among
+    // equals)
+    if (bound != nullptr) {
+        std::sort(anchors.begin(), anchors.end(), [](const Anchor& a, const Anchor& b) {
+            if (a.upper_bound != b.upper_bound) return a.upper_bound > b.upper_bound;
+            if (a.row != b.row) return a.row < b.row;
+            if (a.col != b.col) return a.col < b.col;
+            return a.direction == Direction::VERTICAL && b.direction != Direction::VERTICAL;
+        });
+    }
+
+    // A task grows the moves of one anchor; on several threads, one task
+    // per letter of the tile on the anchor
+    vector<SearchTask>& tasks = scratch_.tasks;
+    tasks.clear();
+    for (int index = 0; index < static_cast<int>(anchors.size()); index++) {
+        const Anchor& anchor = anchors[index];
+        if (sink_count == 1) {
+            tasks.push_back(SearchTask{index, DAWG::LETTER_MASK});
+            continue;
+        }
+        uint32_t first_letters = graph.cursor().childMask() &
+                                 (letter_count[26] > 0 ? DAWG::LETTER_MASK : rack_mask) &
+                                 crossChecks().get(anchor.row, anchor.col, anchor.direction);
+        while (first_letters != 0) {
+            int bit = __builtin_ctz(first_letters);
+            first_letters &= first_letters - 1;
+            tasks.push_back(SearchTask{index, 1u << bit});
+        }
+    }
+
+    int task_count = static_cast<int>(tasks.size());
+#pragma omp parallel for schedule(dynamic, 1) num_threads(sink_count) if (sink_count > 1)
+    for (int task = 0; task < task_count; task++) {
+        const Anchor& anchor = anchors[tasks[task].item];
+        if (bound != nullptr && anchor.upper_bound < bound->floor()) {
+            continue;
+        }
+
+        int task_letters[27];
+        std::copy(letter_count, letter_count + 27, task_letters);
+
+        TaskMoves moves{&sinks[omp_get_thread_num()], task};
+        MoveSink sink = makeSink(moves);
+        AnchorSearch search;
+        search.row = anchor.row;
+        search.col = anchor.col;
+        search.direction = anchor.direction;
+        search.placed_count = 0;
+        search.sink = &sink;
+        search.first_letters = tasks[task].first_letters;
+        search.bound = bound;
+        gaddagGenerate(task_letters, rack_mask, graph.cursor(), 0, RunningScore(), search);
+    }
+}
+
+void MoveGenerator::gaddagGenerate(int letter_count[27], uint32_t rack_mask, DAWG::Cursor node, int offset,
+                                   RunningScore score, AnchorSearch& search) const {
+    int row, col;
+    isOnBoardAt(search, offset, row, col);
+
+    if (!board_->isEmpty(row, col)) {
         // There's a tile on the board - we must use it
-        char existing_letter = toupper(board_.getLetter(current_row, current_col));
-        auto it = node->children.find(existing_letter);
-        if (it != node->children.end()) {
-            // Continue to next position without placing a tile from rack
-            dfsGenerateMoves(letter_count, it->second, tiles_from_rack, position_offset + 1, pos, raw_moves);
+        char existing_letter = toupper(board_->getLetter(row, col));
+        DAWG::Cursor child = node.child(existing_letter);
+        if (child.valid()) {
+            gaddagContinue(letter_count, rack_mask, child, offset, addBoardTile(score, row, col), search);
         }
         return;
     }
 
-    // Empty square - try extending with each available letter from the rack
-    for (int c = 0; c < 26; ++c) {
+    // A word is grown from its first anchor only: before the anchor, tiles
+    // may not cover another anchor (that anchor generates those moves)
+    if (offset < 0 && crossChecks().isAnchor(row, col)) {
+        return;
+    }
+    if (search.placed_count >= Rack::MAX_TILES) {
+        return;
+    }
+
+    // Letters only (LETTER_MASK leaves out the separator bit) that form
+    // valid cross-words on this square
+    uint32_t candidates = node.childMask() & (letter_count[26] > 0 ? DAWG::LETTER_MASK : rack_mask) &
+                          crossChecks().get(row, col, search.direction) &
+                          (offset == 0 ? search.first_letters : DAWG::LETTER_MASK);
+    while (candidates != 0) {
+        int c = __builtin_ctz(candidates);
+        candidates &= candidates - 1;
+        DAWG::Cursor child = node.childByBit(c);
+        char letter = 'A' + c;
+
         // First, try using a regular tile
         if (letter_count[c] > 0) {
-            // Check if this letter extends to a valid prefix in the DAWG
-            char letter = 'A' + c;
-            auto it = node->children.find(letter);
-            if (it != node->children.end()) {
-                // Choose this letter (uppercase = regular tile)
-                letter_count[c]--;
-                tiles_from_rack.push_back(letter);
-
-                // Recurse
-                dfsGenerateMoves(letter_count, it->second, tiles_from_rack, position_offset + 1, pos, raw_moves);
-
-                // Undo choice
-                tiles_from_rack.pop_back();
-                letter_count[c]++;
-            }
+            letter_count[c]--;
+            uint32_t remaining = letter_count[c] > 0 ? rack_mask : rack_mask & ~(1u << c);
+            search.placed[search.placed_count++] = TilePlacement(row, col, letter, true, false);
+            gaddagContinue(letter_count, remaining, child, offset,
+                           addPlacedTile(score, row, col, search.direction, c, false), search);
+            search.placed_count--;
+            letter_count[c]++;
         }
 
-        // Also try using a blank tile for this letter (if we have any)
-        if (letter_count[26] > 0) {
-            char letter = 'A' + c;
-            auto it = node->children.find(letter);
-            if (it != node->children.end()) {
-                // Choose this letter using a blank (lowercase = blank tile)
-                letter_count[26]--;
-                tiles_from_rack.push_back('a' + c);  // lowercase to mark as blank
+        // Also try using a blank tile for this letter (if we have any;
+        // symbolic in bounded searches, see dfsGenerateMoves)
+        if (letter_count[26] > 0 && (search.bound == nullptr || letter_count[c] == 0)) {
+            letter_count[26]--;
+            search.placed[search.placed_count++] = TilePlacement(row, col, letter, true, true);
+            gaddagContinue(letter_count, rack_mask, child, offset,
+                           addPlacedTile(score, row, col, search.direction, c, search.bound == nullptr), search);
+            search.placed_count--;
+            letter_count[26]++;
+        }
+    }
+}
 
-                // Recurse
-                dfsGenerateMoves(letter_count, it->second, tiles_from_rack, position_offset + 1, pos, raw_moves);
+void MoveGenerator::gaddagContinue(int letter_count[27], uint32_t rack_mask, DAWG::Cursor node, int offset,
+                                   RunningScore score, AnchorSearch& search) const {
+    int row, col;
 
-                // Undo choice
-                tiles_from_rack.pop_back();
-                letter_count[26]++;
+    if (offset <= 0) {
+        // Still reading the reversed prefix (leftwards / upwards)
+        bool has_before = isOnBoardAt(search, offset - 1, row, col);
+        bool before_free = !has_before || board_->isEmpty(row, col);
+        bool has_after = isOnBoardAt(search, 1, row, col);
+        bool after_free = !has_after || board_->isEmpty(row, col);
+
+        // Whole word read backwards, with nothing on either side
+        if (before_free && after_free && node.isEndOfWord()) {
+            recordAnchorMove(search, score);
+        }
+
+        // Keep extending the prefix
+        if (has_before) {
+            gaddagGenerate(letter_count, rack_mask, node, offset - 1, score, search);
+        }
+
+        // Prefix complete: cross the separator and extend past the anchor
+        if (before_free && has_after) {
+            DAWG::Cursor separator = node.child(GADDAG::SEPARATOR);
+            if (separator.valid()) {
+                gaddagGenerate(letter_count, rack_mask, separator, 1, score, search);
             }
         }
+    } else {
+        // Reading the suffix (rightwards / downwards)
+        bool has_after = isOnBoardAt(search, offset + 1, row, col);
+        bool after_free = !has_after || board_->isEmpty(row, col);
+
+        if (after_free && node.isEndOfWord()) {
+            recordAnchorMove(search, score);
+        }
+
+        if (has_after) {
+            gaddagGenerate(letter_count, rack_mask, node, offset + 1, score, search);
+        }
     }
 }
 
-RawMove MoveGenerator::createRawMove(
-    const string& tile_sequence,
-    const StartPosition& pos) const {
-    RawMove move;
-    move.direction = pos.direction;
-    move.start_row = pos.row;
-    move.start_col = pos.col;
+void MoveGenerator::recordAnchorMove(const AnchorSearch& search, const RunningScore& score) const {
+    TilePlacement tiles[Rack::MAX_TILES];
+    int tile_count = search.placed_count;
+    std::copy(search.placed, search.placed + tile_count, tiles);
+
+    // Tiles were placed outward from the anchor: first the anchor and the
+    // ones before it (walking backwards), then the ones after it
+    int up_to_anchor = 0;
+    while (up_to_anchor < tile_count && tiles[up_to_anchor].row <= search.row &&
+           tiles[up_to_anchor].col <= search.col) {
+        up_to_anchor++;
+    }
+    std::reverse(tiles, tiles + up_to_anchor);
 
-    int row = pos.row;
-    int col = pos.col;
-    size_t tile_idx = 0;
+    MoveView move{search.direction, finalScore(score, tile_count), tile_count, tiles};
+    if (search.bound != nullptr) {
+        visitBlankAssignments(move, *search.sink, search.bound->best_only);
+    } else {
+        (*search.sink)(move);
+    }
+}
 
-    // Place tiles in the specified direction, skipping occupied squares
-    while (tile_idx < tile_sequence.size() && row <= 14 && col <= 14) {
-        if (board_.isEmpty(row, col)) {
-            // Place the next tile from the sequence
-            char c = tile_sequence[tile_idx];
-            bool is_blank = (c >= 'a' && c <= 'z');   // lowercase = blank
-            char letter = is_blank ? toupper(c) : c;  // convert to uppercase for display
+void MoveGenerator::visitBlankAssignments(const MoveView& move, const MoveSink& sink, bool best_only) const {
+    if (letters_[26] == 0) {
+        sink(move);
+        return;
+    }
 
-            TilePlacement placement(row, col, letter, true, is_blank);
-            move.placements.push_back(placement);
-            tile_idx++;
+    // What a regular tile scores over a blank on each square, in the main
+    // word and in its cross-word
+    int word_multiplier = 1;
+    for (const auto& tile : move) {
+        word_multiplier *= Scorer::wordMultiplier(board_->getCell(tile.row, tile.col).premium);
+    }
+    int gains[Rack::MAX_TILES];
+    for (int i = 0; i < move.tile_count; i++) {
+        const TilePlacement& tile = move.tiles[i];
+        PremiumType premium = board_->getCell(tile.row, tile.col).premium;
+        int letter_value = Scorer::letterValues()[tile.letter - 'A'] * Scorer::letterMultiplier(premium);
+        gains[i] = letter_value * word_multiplier;
+        if (crossChecks().getCrossSum(tile.row, tile.col, move.direction) != CrossChecks::NO_CROSS_WORD) {
+            gains[i] += letter_value * Scorer::wordMultiplier(premium);
         }
-        // Move to next position
-        getNext(row, col, pos.direction);
     }
 
-    return move;
+    // Letters the search had to play with blanks (their regular tiles ran
+    // out): any choice of blank squares keeps at least that many on them
+    uint32_t blank_squares = 0;
+    for (int i = 0; i < move.tile_count; i++) {
+        blank_squares |= move.tiles[i].is_blank ? 1u << i : 0;
+    }
+    uint32_t short_squares[Rack::MAX_TILES];
+    int short_needed[Rack::MAX_TILES];
+    int short_count = 0;
+    for (uint32_t rest = blank_squares; rest != 0; rest &= rest - 1) {
+        char letter = move.tiles[__builtin_ctz(rest)].letter;
+        uint32_t squares = 0;
+        for (int i = 0; i < move.tile_count; i++) {
+            squares |= move.tiles[i].letter == letter ? 1u << i : 0;
+        }
+        if (std::find(short_squares, short_squares + short_count, squares) == short_squares + short_count) {
+            short_squares[short_count] = squares;
+            short_needed[short_count++] = __builtin_popcount(squares & blank_squares);
+        }
+    }
+
+    // Every playable choice of blank squares (bit i = tile i), by number of
+    // blanks, with what it costs
+    struct Choice {
+        uint32_t blanks;
+        int cost;
+    };
+    Choice choices[1 << Rack::MAX_TILES];
+    int choice_count = 0;
+    int least_cost = std::numeric_limits<int>::max();
+    int most_blanks = min(letters_[26], move.tile_count);
+    for (int size = __builtin_popcount(blank_squares); size <= most_blanks; size++) {
+        // Subsets of `size` squares in increasing order (Gosper's hack)
+        uint32_t blanks = (1u << size) - 1;
+        while (blanks < (1u << move.tile_count)) {
+            bool playable = true;
+            for (int i = 0; i < short_count && playable; i++) {
+                playable = __builtin_popcount(blanks & short_squares[i]) >= short_needed[i];
+            }
+            if (playable) {
+                int cost = 0;
+                for (uint32_t rest = blanks; rest != 0; rest &= rest - 1) {
+                    cost += gains[__builtin_ctz(rest)];
+                }
+                choices[choice_count++] = Choice{blanks, cost};
+                least_cost = min(least_cost, cost);
+            }
+            if (blanks == 0) {
+                break;
+            }
+            uint32_t lowest = blanks & -blanks;
+            uint32_t carried = blanks + lowest;
+            blanks = carried | (((carried ^ blanks) >> 2) / lowest);
+        }
+    }
+
+    // A best-only search just wants the choices that cost least
+    TilePlacement tiles[Rack::MAX_TILES];
+    std::copy(move.begin(), move.end(), tiles);
+    for (int c = 0; c < choice_count; c++) {
+        if (best_only && choices[c].cost != least_cost) {
+            continue;
+        }
+        for (int i = 0; i < move.tile_count; i++) {
+            tiles[i].is_blank = (choices[c].blanks >> i) & 1;
+        }
+        sink(MoveView{move.direction, move.score - choices[c].cost, move.tile_count, tiles});
+    }
 }
 
-vector<Move> MoveGenerator::filterValidMoves(const vector<RawMove>& raw_moves) const {
-    vector<Move> valid_moves;
+bool MoveGenerator::isOnBoardAt(const AnchorSearch& search, int offset, int& row, int& col) const {
+    row = search.row;
+    col = search.col;
+    if (search.direction == Direction::HORIZONTAL) {
+        col += offset;
+    } else {
+        row += offset;
+    }
+    return board_->isValidPosition(row, col);
+}
 
-    for (const auto& raw_move : raw_moves) {
-        if (isValidMove(raw_move)) {
-            // Get the main word for the move
-            string main_word = getMainWord(raw_move);
+int MoveGenerator::layoutTiles(const string& tile_sequence, const StartPosition& pos, TilePlacement* tiles) const {
+    int start;
+    Line line = lineThrough(pos.row, pos.col, pos.direction, start);
+    int tile_count = 0;
 
-            // Convert to Move and add to valid moves
-            Move move = rawMoveToMove(raw_move, main_word);
+    // Place tiles on the empty squares from the start position on
+    uint32_t empty = ~line.occupied & (Board::LINE_MASK << start) & Board::LINE_MASK;
+    for (; tile_count < static_cast<int>(tile_sequence.size()) && empty != 0; empty &= empty - 1) {
+        int at = __builtin_ctz(empty);
+        char c = tile_sequence[tile_count];
+        bool is_blank = (c >= 'a' && c <= 'z');   // lowercase = blank
+        char letter = is_blank ? toupper(c) : c;  // convert to uppercase for display
 
-            valid_moves.push_back(move);
-        }
+        tiles[tile_count++] = TilePlacement(line.row(at), line.col(at), letter, true, is_blank);
     }
 
-    return valid_moves;
+    return tile_count;
 }
 
 bool MoveGenerator::isValidMove(const RawMove& raw_move) const {
@@ -399,170 +1005,238 @@ string MoveGenerator::getMainWord(const RawMove& raw_move) const {
         return "";
     }
 
-    Direction dir = raw_move.direction;
+    // The word through the start square: board tiles before it, then board
+    // and placed tiles up to the first gap
+    int offset;
+    int start;
+    Line line = lineThrough(raw_move.start_row, raw_move.start_col, raw_move.direction, offset);
+    return readWord(line, offset, raw_move.placements.data(), raw_move.placements.size(), start);
+}
 
-    // Find the actual start of the word by walking backward from start position
-    int word_start_row = raw_move.start_row;
-    int word_start_col = raw_move.start_col;
+vector<string> MoveGenerator::getCrossWords(const RawMove& raw_move) const {
+    vector<string> cross_words;
 
-    int prev_row = word_start_row;
-    int prev_col = word_start_col;
-    getPrev(prev_row, prev_col, dir);
+    // For each newly placed tile, check for cross-words in the perpendicular direction
+    Direction perp_dir = (raw_move.direction == Direction::HORIZONTAL) ? Direction::VERTICAL : Direction::HORIZONTAL;
 
-    while (prev_row >= 0 && prev_col >= 0 && prev_row <= 14 && prev_col <= 14 &&
-           !board_.isEmpty(prev_row, prev_col)) {
-        word_start_row = prev_row;
-        word_start_col = prev_col;
-        getPrev(prev_row, prev_col, dir);
-    }
+    for (const auto& placement : raw_move.placements) {
+        int offset;
+        Line line = lineThrough(placement.row, placement.col, perp_dir, offset);
 
-    // Now walk forward from the actual start, collecting all letters
-    string word = "";
-    int row = word_start_row;
-    int col = word_start_col;
+        // No cross-word unless a tile touches this one
+        bool has_prev = offset > 0 && !line.isEmpty(offset - 1);
+        bool has_next = !line.isEmpty(offset + 1);
+        if (!has_prev && !has_next) {
+            continue;
+        }
 
-    while (row >= 0 && col >= 0 && row <= 14 && col <= 14) {
-        if (!board_.isEmpty(row, col)) {
-            // Existing tile on board (convert to uppercase, as blanks are stored as lowercase)
-            char letter = board_.getLetter(row, col);
-            word += toupper(letter);
-        } else {
-            // Check if we placed a tile here
-            bool found = false;
-            for (const auto& placement : raw_move.placements) {
-                if (placement.row == row && placement.col == col) {
-                    word += placement.letter;
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                break;  // No tile here, end of word
-            }
+        int start;
+        string cross_word = readWord(line, offset, &placement, 1, start);
+        if (cross_word.length() > 1) {
+            cross_words.push_back(cross_word);
         }
-        getNext(row, col, dir);
     }
 
-    return word;
+    return cross_words;
 }
 
-vector<string> MoveGenerator::getCrossWords(const RawMove& raw_move) const {
-    vector<string> cross_words;
+// ============================================================================
+// Running score
+// ============================================================================
 
-    // For each newly placed tile, check for cross-words in the perpendicular direction
-    Direction perp_dir = (raw_move.direction == Direction::HORIZONTAL) ? Direction::VERTICAL : Direction::HORIZONTAL;
+MoveGenerator::RunningScore MoveGenerator::addBoardTile(RunningScore score, int row, int col) const {
+    // Tiles already on the board get no premium; blanks (lowercase) score 0
+    char letter = board_->getLetter(row, col);
+    if (std::isupper(static_cast<unsigned char>(letter))) {
+        score.main_sum += Scorer::letterValues()[letter - 'A'];
+    }
+    return score;
+}
 
-    for (const auto& placement : raw_move.placements) {
-        int row = placement.row;
-        int col = placement.col;
+MoveGenerator::RunningScore MoveGenerator::addPlacedTile(RunningScore score, int row, int col, Direction dir,
+                                                         int letter_index, bool is_blank) const {
+    PremiumType premium = board_->getCell(row, col).premium;
+    int letter_value = is_blank ? 0 : Scorer::letterValues()[letter_index] * Scorer::letterMultiplier(premium);
+    int word_multiplier = Scorer::wordMultiplier(premium);
 
-        // Check if there are tiles adjacent in the perpendicular direction
-        int prev_row = row;
-        int prev_col = col;
-        getPrev(prev_row, prev_col, perp_dir);
+    score.main_sum += letter_value;
+    score.word_multiplier *= word_multiplier;
 
-        int next_row = row;
-        int next_col = col;
-        getNext(next_row, next_col, perp_dir);
+    // The perpendicular word through this tile is complete as soon as it is placed
+    int cross_sum = crossChecks().getCrossSum(row, col, dir);
+    if (cross_sum != CrossChecks::NO_CROSS_WORD) {
+        score.cross_total += (cross_sum + letter_value) * word_multiplier;
+    }
+    return score;
+}
 
-        bool has_prev = (prev_row >= 0 && prev_col >= 0 && prev_row <= 14 && prev_col <= 14 &&
-                         !board_.isEmpty(prev_row, prev_col));
-        bool has_next = (next_row >= 0 && next_col >= 0 && next_row <= 14 && next_col <= 14 &&
-                         !board_.isEmpty(next_row, next_col));
+int MoveGenerator::finalScore(const RunningScore& score, int tiles_placed) {
+    int total = score.main_sum * score.word_multiplier + score.cross_total;
+    if (tiles_placed >= Rack::MAX_TILES) {
+        total += Scorer::BINGO_BONUS;
+    }
+    return total;
+}
 
-        if (!has_prev && !has_next) {
-            // No cross-word formed by this tile
-            continue;
-        }
+// ============================================================================
+// Score bounds (best-only search)
+// ============================================================================
 
-        // Find the start of the cross-word
-        int word_start_row = row;
-        int word_start_col = col;
+void MoveGenerator::addToWindow(BoundWindow& window, int row, int col, Direction dir,
+                                const ScoreBound& bound) const {
+    if (!board_->isEmpty(row, col)) {
+        window.board_sum += addBoardTile(RunningScore(), row, col).main_sum;
+        return;
+    }
 
-        prev_row = row;
-        prev_col = col;
-        getPrev(prev_row, prev_col, perp_dir);
+    PremiumType premium = board_->getCell(row, col).premium;
+    int letter_multiplier = Scorer::letterMultiplier(premium);
+    int word_multiplier = Scorer::wordMultiplier(premium);
+    int cross_sum = crossChecks().getCrossSum(row, col, dir);
+    window.letter_premiums[letter_multiplier]++;
+    window.word_premiums[word_multiplier]++;
+    window.cross_scores[window.empty_count++] =
+        cross_sum == CrossChecks::NO_CROSS_WORD ? 0 : (cross_sum + bound.best_value * letter_multiplier) * word_multiplier;
+}
 
-        while (prev_row >= 0 && prev_col >= 0 && prev_row <= 14 && prev_col <= 14 &&
-               !board_.isEmpty(prev_row, prev_col)) {
-            word_start_row = prev_row;
-            word_start_col = prev_col;
-            getPrev(prev_row, prev_col, perp_dir);
+MoveGenerator::RunningScore MoveGenerator::bestExtension(const BoundWindow& window, int tiles_left, int tiles_placed,
+                                                         const ScoreBound& bound) {
+    int placeable = min(min(tiles_left, window.empty_count), Rack::MAX_TILES);
+    RunningScore extension;
+    extension.main_sum = window.board_sum;
+
+    // The best values go on the best letter premiums, and the tiles cover
+    // the best word premiums and cross-words
+    int used = 0;
+    for (int multiplier = 3; multiplier >= 1; multiplier--) {
+        int count = min(window.letter_premiums[multiplier], placeable - used);
+        extension.main_sum += multiplier * (bound.top_sums[used + count] - bound.top_sums[used]);
+        used += count;
+    }
+    used = 0;
+    for (int multiplier = 3; multiplier >= 2; multiplier--) {
+        for (int i = min(window.word_premiums[multiplier], placeable - used); i > 0; i--) {
+            extension.word_multiplier *= multiplier;
+            used++;
         }
+    }
+    if (placeable < window.empty_count) {
+        int cross_scores[Board::SIZE];
+        std::copy(window.cross_scores, window.cross_scores + window.empty_count, cross_scores);
+        std::partial_sort(cross_scores, cross_scores + placeable, cross_scores + window.empty_count,
+                          std::greater<int>());
+        extension.cross_total = std::accumulate(cross_scores, cross_scores + placeable, 0);
+    } else {
+        extension.cross_total = std::accumulate(window.cross_scores, window.cross_scores + placeable, 0);
+    }
 
-        // Collect the cross-word
-        string cross_word = "";
-        int curr_row = word_start_row;
-        int curr_col = word_start_col;
+    if (tiles_placed + placeable >= Rack::MAX_TILES) {
+        extension.cross_total += Scorer::BINGO_BONUS;
+    }
+    return extension;
+}
 
-        while (curr_row >= 0 && curr_col >= 0 && curr_row <= 14 && curr_col <= 14) {
-            if (!board_.isEmpty(curr_row, curr_col)) {
-                // Existing tile on board (convert to uppercase, as blanks are stored as lowercase)
-                char letter = board_.getLetter(curr_row, curr_col);
-                cross_word += toupper(letter);
-            } else if (curr_row == row && curr_col == col) {
-                // This is the newly placed tile
-                cross_word += placement.letter;
-            } else {
+int MoveGenerator::upperBound(const RunningScore& score, const RunningScore& extension) {
+    return (score.main_sum + extension.main_sum) * score.word_multiplier * extension.word_multiplier +
+           score.cross_total + extension.cross_total;
+}
+
+void MoveGenerator::boundPosition(const StartPosition& pos, PositionBound& bound) const {
+    bound.tile_limit = min(bound.search->tile_count, pos.max_extension);
+
+    // Squares the position's moves may cover: up to its last usable empty
+    // square and the board tiles right after it
+    int start;
+    Line line = lineThrough(pos.row, pos.col, pos.direction, start);
+    int end = start;
+    int empty_count = 0;
+    for (; end < Board::SIZE; end++) {
+        if (line.isEmpty(end)) {
+            if (empty_count == bound.tile_limit) {
                 break;
             }
-            getNext(curr_row, curr_col, perp_dir);
+            empty_count++;
         }
+    }
 
-        if (cross_word.length() > 1) {
-            cross_words.push_back(cross_word);
+    // Grow the window backwards: when it reaches the i-th empty square, it
+    // holds everything the tiles after the first i can still cover
+    BoundWindow window;
+    bound.extensions[empty_count] = RunningScore();
+    for (int at = end - 1; at >= start; at--) {
+        addToWindow(window, line.row(at), line.col(at), pos.direction, *bound.search);
+        if (line.isEmpty(at)) {
+            int tiles_placed = empty_count - window.empty_count;
+            bound.extensions[tiles_placed] =
+                bestExtension(window, bound.tile_limit - tiles_placed, tiles_placed, *bound.search);
         }
     }
-
-    return cross_words;
 }
 
-Move MoveGenerator::rawMoveToMove(const RawMove& raw_move, const string& word) const {
-    // Find the actual start of the word (may be before start_row/start_col if there are existing tiles)
-    Direction dir = raw_move.direction;
-    int word_start_row = raw_move.start_row;
-    int word_start_col = raw_move.start_col;
-
-    int prev_row = word_start_row;
-    int prev_col = word_start_col;
-    getPrev(prev_row, prev_col, dir);
-
-    while (prev_row >= 0 && prev_col >= 0 && prev_row <= 14 && prev_col <= 14 &&
-           !board_.isEmpty(prev_row, prev_col)) {
-        word_start_row = prev_row;
-        word_start_col = prev_col;
-        getPrev(prev_row, prev_col, dir);
+int MoveGenerator::anchorUpperBound(int row, int col, Direction dir, const ScoreBound& bound) const {
+    int anchor;
+    Line line = lineThrough(row, col, dir, anchor);
+
+    // Tiles before the anchor stop short of the previous anchor
+    int tiles = min(bound.tile_count, Rack::MAX_TILES);
+    int before = 0;
+    int start = anchor;
+    for (int at = anchor - 1; at >= 0; at--) {
+        if (line.isEmpty(at)) {
+            if (before == tiles - 1 || crossChecks().isAnchor(line.row(at), line.col(at))) {
+                break;
+            }
+            before++;
+        }
+        start = at;
     }
 
-    // Create the move
-    Move move(word_start_row, word_start_col, dir, word);
-
-    // Add all placements from the raw move
-    for (const auto& placement : raw_move.placements) {
-        move.addPlacement(placement);
+    // Then up to a full rack from the anchor on
+    BoundWindow window;
+    for (int at = start; at < Board::SIZE && (!line.isEmpty(at) || window.empty_count < before + tiles); at++) {
+        addToWindow(window, line.row(at), line.col(at), dir, bound);
     }
 
-    return move;
+    return upperBound(RunningScore(), bestExtension(window, tiles, 0, bound));
 }
 
 // ============================================================================
-// Utility functions
+// Board lines
 // ============================================================================
 
-void MoveGenerator::getNext(int& row, int& col, Direction dir) const {
-    if (dir == Direction::HORIZONTAL) {
-        col++;
-    } else {
-        row++;
-    }
+MoveGenerator::Line MoveGenerator::lineThrough(int row, int col, Direction dir, int& offset) const {
+    int index = dir == Direction::HORIZONTAL ? row : col;
+    offset = dir == Direction::HORIZONTAL ? col : row;
+    return Line{board_->line(dir, index), board_->lineOccupancy(dir, index), index, dir};
 }
 
-void MoveGenerator::getPrev(int& row, int& col, Direction dir) const {
-    if (dir == Direction::HORIZONTAL) {
-        col--;
-    } else {
-        row--;
+string MoveGenerator::readWord(const Line& line, int offset, const TilePlacement* tiles, int tile_count,
+                               int& start) {
+    // Lay the tiles over a copy of the line
+    char letters[Board::LINE_STRIDE];
+    std::memcpy(letters, line.letters, Board::LINE_STRIDE);
+    uint32_t filled = line.occupied;
+    for (int i = 0; i < tile_count; i++) {
+        int at = line.direction == Direction::HORIZONTAL ? tiles[i].col : tiles[i].row;
+        if (line.row(at) == tiles[i].row && line.col(at) == tiles[i].col && line.isEmpty(at)) {
+            letters[at] = tiles[i].letter;
+            filled |= 1u << at;
+        }
+    }
+
+    // The word starts after the last gap before `offset` and ends at the next one
+    uint32_t gaps = ~filled & Board::LINE_MASK;
+    uint32_t gaps_before = gaps & ((1u << offset) - 1);
+    start = gaps_before != 0 ? 32 - __builtin_clz(gaps_before) : 0;
+    uint32_t gaps_after = gaps & ~((1u << start) - 1);
+    int end = gaps_after != 0 ? __builtin_ctz(gaps_after) : Board::SIZE;
+
+    // Letters only: clearing bit 5 uppercases blanks
+    string word(letters + start, letters + end);
+    for (char& letter : word) {
+        letter &= ~0x20;
     }
+    return word;
 }
 
 }  // namespace scradle
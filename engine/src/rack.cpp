@@ -4,6 +4,7 @@
 #include <cctype>
 
 #include "tile_bag.h"
+#include "zobrist.h"
 
 using std::count;
 using std::find;
@@ -12,7 +13,7 @@ using std::toupper;
 
 namespace scradle {
 
-Rack::Rack() : tiles_("") {}
+Rack::Rack() : tiles_(""), hash_(0) {}
 
 Rack::Rack(const string& tiles) : tiles_(tiles) {
     // Convert to uppercase (except for '?' which represents blank tiles)
@@ -21,6 +22,7 @@ Rack::Rack(const string& tiles) : tiles_(tiles) {
             c = toupper(static_cast<unsigned char>(c));
         }
     }
+    rehash();
 }
 
 char Rack::getTile(int index) const {
@@ -37,6 +39,7 @@ void Rack::setTiles(const string& tiles) {
             c = toupper(static_cast<unsigned char>(c));
         }
     }
+    rehash();
 }
 
 bool Rack::hasTile(char letter) const {
@@ -54,16 +57,15 @@ void Rack::removeTile(char letter) {
     auto it = find(tiles_.begin(), tiles_.end(), upper);
     if (it != tiles_.end()) {
         tiles_.erase(it);
+        hash_ ^= zobrist::rackKey(upper, countTile(upper));
     }
 }
 
 void Rack::addTile(char letter) {
     if (tiles_.size() < MAX_TILES) {
-        if (letter == '?') {
-            tiles_ += '?';
-        } else {
-            tiles_ += toupper(static_cast<unsigned char>(letter));
-        }
+        char tile = letter == '?' ? '?' : toupper(static_cast<unsigned char>(letter));
+        hash_ ^= zobrist::rackKey(tile, countTile(tile));
+        tiles_ += tile;
     }
 }
 
@@ -94,6 +96,17 @@ bool Rack::isValid(int move_count) const {
     }
 }
 
+void Rack::rehash() {
+    hash_ = 0;
+    int copies[zobrist::TILES] = {};
+    for (char tile : tiles_) {
+        int index = zobrist::tileIndex(tile);
+        if (index >= 0) {
+            hash_ ^= zobrist::rackKey(tile, copies[index]++);
+        }
+    }
+}
+
 string Rack::toString() const {
     return tiles_.empty() ? "(empty)" : tiles_;
 }
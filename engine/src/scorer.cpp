@@ -1,66 +1,9 @@
 #include "scorer.h"
 
-#include <cctype>
+#include <string>
 
 namespace scradle {
 
-Scorer::Scorer() {
-    initializeLetterValues();
-}
-
-void Scorer::initializeLetterValues() {
-    // French Scrabble letter values
-    // 0 points: blank tiles (represented as '?')
-    letter_values_['?'] = 0;
-
-    // 1 point
-    letter_values_['E'] = 1;
-    letter_values_['A'] = 1;
-    letter_values_['I'] = 1;
-    letter_values_['N'] = 1;
-    letter_values_['O'] = 1;
-    letter_values_['R'] = 1;
-    letter_values_['S'] = 1;
-    letter_values_['T'] = 1;
-    letter_values_['U'] = 1;
-    letter_values_['L'] = 1;
-
-    // 2 points
-    letter_values_['D'] = 2;
-    letter_values_['M'] = 2;
-    letter_values_['G'] = 2;
-
-    // 3 points
-    letter_values_['B'] = 3;
-    letter_values_['C'] = 3;
-    letter_values_['P'] = 3;
-
-    // 4 points
-    letter_values_['F'] = 4;
-    letter_values_['H'] = 4;
-    letter_values_['V'] = 4;
-
-    // 8 points
-    letter_values_['J'] = 8;
-    letter_values_['Q'] = 8;
-
-    // 10 points
-    letter_values_['K'] = 10;
-    letter_values_['W'] = 10;
-    letter_values_['X'] = 10;
-    letter_values_['Y'] = 10;
-    letter_values_['Z'] = 10;
-}
-
-int Scorer::getLetterValue(char letter) const {
-    char upper = std::toupper(static_cast<unsigned char>(letter));
-    auto it = letter_values_.find(upper);
-    if (it != letter_values_.end()) {
-        return it->second;
-    }
-    return 0;  // Unknown letters have 0 value
-}
-
 int Scorer::scoreMove(const Board& board, const Move& move) const {
     int total_score = 0;
 
@@ -85,52 +28,39 @@ int Scorer::scoreMainWord(const Board& board, const Move& move) const {
     int row = move.getStartRow();
     int col = move.getStartCol();
     Direction dir = move.getDirection();
+    const std::string word = move.getWord();
+    int length = static_cast<int>(word.length());
 
-    // Iterate through each letter in the word
-    for (size_t i = 0; i < move.getWord().length(); ++i) {
-        char letter = move.getWord()[i];
-
-        // Check if this is a new tile (from rack) and if it's a blank
-        bool is_new_tile = false;
-        bool is_blank = false;
-        for (const auto& placement : move.getPlacements()) {
-            if (placement.row == row && placement.col == col) {
-                if (placement.is_from_rack) {
-                    is_new_tile = true;
-                }
-                is_blank = placement.is_blank;
-                break;
-            }
+    // Placement covering each square of the word, if any
+    const TilePlacement* placed[Move::MAX_LENGTH] = {};
+    for (const auto& placement : move.getPlacements()) {
+        bool on_line = dir == Direction::HORIZONTAL ? placement.row == row : placement.col == col;
+        int offset = dir == Direction::HORIZONTAL ? placement.col - col : placement.row - row;
+        if (on_line && offset >= 0 && offset < length && placed[offset] == nullptr) {
+            placed[offset] = &placement;
         }
+    }
 
-        if (!is_new_tile) {
+    // Iterate through each letter in the word
+    for (int i = 0; i < length; ++i) {
+        const TilePlacement* placement = placed[i];
+        bool is_new_tile = placement != nullptr && placement->is_from_rack;
+        bool is_blank;
+        if (is_new_tile) {
+            is_blank = placement->is_blank;
+        } else {
             char letter = board.getLetter(row, col);
             is_blank = letter >= 'a' && letter <= 'z';
         }
 
         // Calculate letter value: 0 for blanks, normal value otherwise
-        int letter_value = is_blank ? 0 : getLetterValue(letter);
+        int letter_value = is_blank ? 0 : getLetterValue(word[i]);
 
         // Apply premium squares only for new tiles
         if (is_new_tile) {
-            const Cell& cell = board.getCell(row, col);
-
-            switch (cell.premium) {
-                case PremiumType::DOUBLE_LETTER:
-                    letter_value *= 2;
-                    break;
-                case PremiumType::TRIPLE_LETTER:
-                    letter_value *= 3;
-                    break;
-                case PremiumType::DOUBLE_WORD:
-                    word_multiplier *= 2;
-                    break;
-                case PremiumType::TRIPLE_WORD:
-                    word_multiplier *= 3;
-                    break;
-                case PremiumType::NONE:
-                    break;
-            }
+            PremiumType premium = board.getCell(row, col).premium;
+            letter_value *= letterMultiplier(premium);
+            word_multiplier *= wordMultiplier(premium);
         }
 
         word_score += letter_value;
@@ -205,9 +135,6 @@ int Scorer::scoreCrossWords(const Board& board, const Move& move) const {
                 } else {
                     // Check if existing tile on board is a blank (lowercase)
                     is_blank = (letter >= 'a' && letter <= 'z');
-                    if (is_blank) {
-                        letter = toupper(letter);  // Convert to uppercase for scoring lookup
-                    }
                 }
 
                 // Calculate letter value: 0 for blanks, normal value otherwise
@@ -215,24 +142,9 @@ int Scorer::scoreCrossWords(const Board& board, const Move& move) const {
 
                 // Apply premium only for the newly placed tile
                 if (r == row && c == col) {
-                    const Cell& cell = board.getCell(r, c);
-
-                    switch (cell.premium) {
-                        case PremiumType::DOUBLE_LETTER:
-                            letter_value *= 2;
-                            break;
-                        case PremiumType::TRIPLE_LETTER:
-                            letter_value *= 3;
-                            break;
-                        case PremiumType::DOUBLE_WORD:
-                            cross_word_multiplier *= 2;
-                            break;
-                        case PremiumType::TRIPLE_WORD:
-                            cross_word_multiplier *= 3;
-                            break;
-                        case PremiumType::NONE:
-                            break;
-                    }
+                    PremiumType premium = board.getCell(r, c).premium;
+                    letter_value *= letterMultiplier(premium);
+                    cross_word_multiplier *= wordMultiplier(premium);
                 }
 
                 cross_word_score += letter_value;
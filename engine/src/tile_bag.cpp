@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <sstream>
 
+#include "zobrist.h"
+
 namespace scradle {
 
-TileBag::TileBag(unsigned int seed) : seed_(seed) {
+TileBag::TileBag(unsigned int seed) : seed_(seed), hash_(0) {
     if (seed == 0) {
         std::random_device rd;
         seed_ = rd();
@@ -16,39 +18,24 @@ TileBag::TileBag(unsigned int seed) : seed_(seed) {
 
 void TileBag::initializeTiles() {
     tiles_.clear();
+    hash_ = 0;
+    for (int letter = 0; letter < 27; ++letter) {
+        char tile = letter == 26 ? '?' : static_cast<char>('A' + letter);
+        for (int i = 0; i < Rules::TILE_COUNTS[letter]; ++i) {
+            insertTile(tile);
+        }
+    }
+}
 
-    // Vowels (45 total)
-    for (int i = 0; i < 9; ++i) tiles_.insert('A');
-    for (int i = 0; i < 15; ++i) tiles_.insert('E');
-    for (int i = 0; i < 8; ++i) tiles_.insert('I');
-    for (int i = 0; i < 6; ++i) tiles_.insert('O');
-    for (int i = 0; i < 6; ++i) tiles_.insert('U');
-    tiles_.insert('Y');  // Y is a vowel in French
-
-    // Consonants (55 total)
-    for (int i = 0; i < 2; ++i) tiles_.insert('B');
-    for (int i = 0; i < 2; ++i) tiles_.insert('C');
-    for (int i = 0; i < 3; ++i) tiles_.insert('D');
-    for (int i = 0; i < 2; ++i) tiles_.insert('F');
-    for (int i = 0; i < 2; ++i) tiles_.insert('G');
-    for (int i = 0; i < 2; ++i) tiles_.insert('H');
-    tiles_.insert('J');
-    tiles_.insert('K');
-    for (int i = 0; i < 5; ++i) tiles_.insert('L');
-    for (int i = 0; i < 3; ++i) tiles_.insert('M');
-    for (int i = 0; i < 6; ++i) tiles_.insert('N');
-    for (int i = 0; i < 2; ++i) tiles_.insert('P');
-    tiles_.insert('Q');
-    for (int i = 0; i < 6; ++i) tiles_.insert('R');
-    for (int i = 0; i < 6; ++i) tiles_.insert('S');
-    for (int i = 0; i < 6; ++i) tiles_.insert('T');
-    for (int i = 0; i < 2; ++i) tiles_.insert('V');
-    tiles_.insert('W');
-    tiles_.insert('X');
-    tiles_.insert('Z');
-
-    // Blanks (2 total)
-    for (int i = 0; i < 2; ++i) tiles_.insert('?');
+void TileBag::insertTile(char tile) {
+    hash_ ^= zobrist::bagKey(tile, tiles_.count(tile));
+    tiles_.insert(tile);
+}
+
+void TileBag::eraseTile(std::multiset<char>::iterator it) {
+    char tile = *it;
+    tiles_.erase(it);
+    hash_ ^= zobrist::bagKey(tile, tiles_.count(tile));
 }
 
 std::string TileBag::drawTiles(int count) {
@@ -74,21 +61,21 @@ char TileBag::drawTile() {
     auto it = tiles_.begin();
     std::advance(it, random_index);
     char tile = *it;
-    tiles_.erase(it);
+    eraseTile(it);
     return tile;
 }
 
 char TileBag::drawTile(char letter) {
     auto it = tiles_.find(letter);
     if (it != tiles_.end()) {
-        tiles_.erase(it);
+        eraseTile(it);
         return letter;
     }
 
     // If the requested letter is not available, try to draw a joker
     auto joker_it = tiles_.find('?');
     if (joker_it != tiles_.end()) {
-        tiles_.erase(joker_it);
+        eraseTile(joker_it);
         return '?';
     }
 
@@ -98,7 +85,7 @@ char TileBag::drawTile(char letter) {
 void TileBag::returnTiles(const std::string& tiles) {
     for (char tile : tiles) {
         if (tile != '\0') {
-            tiles_.insert(tile);
+            insertTile(tile);
         }
     }
 }
@@ -155,12 +142,6 @@ std::string TileBag::toString() const {
     return oss.str();
 }
 
-bool TileBag::isVowel(char letter) {
-    return letter == '?' ||
-           letter == 'A' || letter == 'E' || letter == 'I' ||
-           letter == 'O' || letter == 'U' || letter == 'Y';
-}
-
 bool TileBag::isConsonant(char letter) {
     return letter == '?' || !isVowel(letter);
 }
@@ -0,0 +1,145 @@
+#include <iostream>
+
+#include "board.h"
+#include "cross_checks.h"
+#include "dawg.h"
+#include "move.h"
+#include "move_generator.h"
+#include "rack.h"
+#include "test_framework.h"
+
+using namespace scradle;
+using namespace test;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+static uint32_t bits(const string& letters) {
+    uint32_t mask = 0;
+    for (char c : letters) {
+        mask |= 1u << DAWG::letterBit(c);
+    }
+    return mask;
+}
+
+void test_cross_checks_empty_board() {
+    cout << "\n=== Test: Cross Checks (Empty Board) ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"AT", "TA"});
+
+    Board board;
+    CrossChecks checks;
+    checks.compute(board, dawg);
+
+    assert_equal(DAWG::LETTER_MASK, checks.get(7, 7, Direction::HORIZONTAL), "Empty board allows every letter");
+    assert_equal(DAWG::LETTER_MASK, checks.get(0, 14, Direction::VERTICAL), "Empty board allows every letter (corner)");
+}
+
+void test_cross_checks_around_word() {
+    cout << "\n=== Test: Cross Checks (Around a Word) ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"CHAT", "CHATS", "ET", "TE", "AS", "SA", "ES"});
+
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'H');
+    board.setLetter(7, 9, 'A');
+    board.setLetter(7, 10, 't');  // Blank tiles count as their letter
+
+    CrossChecks checks;
+    checks.compute(board, dawg);
+
+    // Vertical cross-words for a horizontal move
+    assert_equal(bits("E"), checks.get(6, 10, Direction::HORIZONTAL), "Only E above T (ET)");
+    assert_equal(bits("E"), checks.get(8, 10, Direction::HORIZONTAL), "Only E below T (TE)");
+    assert_equal(bits("S"), checks.get(6, 9, Direction::HORIZONTAL), "Only S above A (SA)");
+    assert_equal(0u, checks.get(8, 7, Direction::HORIZONTAL), "Nothing fits below C");
+    assert_equal(DAWG::LETTER_MASK, checks.get(5, 10, Direction::HORIZONTAL), "Two rows away is unconstrained");
+
+    // Horizontal cross-words for a vertical move
+    assert_equal(bits("S"), checks.get(7, 11, Direction::VERTICAL), "Only S after CHAT (CHATS)");
+    assert_equal(0u, checks.get(7, 6, Direction::VERTICAL), "Nothing fits before CHAT");
+
+    // Occupied squares and the other direction
+    assert_equal(0u, checks.get(7, 8, Direction::HORIZONTAL), "Occupied squares allow nothing");
+    assert_equal(DAWG::LETTER_MASK, checks.get(7, 11, Direction::HORIZONTAL),
+                 "Along the word's own line there is no cross-word");
+}
+
+void test_cross_checks_between_tiles() {
+    cout << "\n=== Test: Cross Checks (Between Tiles) ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"ETE", "ETA", "EAE"});
+
+    Board board;
+    board.setLetter(6, 7, 'E');
+    board.setLetter(8, 7, 'E');
+
+    CrossChecks checks;
+    checks.compute(board, dawg);
+
+    assert_equal(bits("AT"), checks.get(7, 7, Direction::HORIZONTAL), "Gap between E and E takes A or T");
+}
+
+void test_cross_checks_generated_moves_valid() {
+    cout << "\n=== Test: Cross Checks (Generated Moves Are Valid) ===" << endl;
+
+    vector<string> words = {"CHAT", "CHATS", "CHANT", "ET", "TE", "AS", "SA", "ES", "TA", "AN", "NA",
+                            "HA", "AH", "THE", "ETA", "TES", "SET", "ANS", "NAS", "HATE", "HATES"};
+    DAWG dawg;
+    dawg.build(words);
+
+    Board board = Board::parseBoard(R"(
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        .......CHAT....
+        ........A......
+        ........T......
+        ........E......
+        ...............
+        ...............
+        ...............
+        ...............
+    )");
+
+    Rack rack("SENAT?");
+    MoveGenerator generator(board, rack, dawg);
+    vector<Move> moves = generator.generateMoves();
+    assert_true(!moves.empty(), "Moves should be generated");
+
+    // Every move must still pass the full dictionary validation
+    int invalid = 0;
+    for (const auto& move : moves) {
+        RawMove raw;
+        raw.direction = move.getDirection();
+        raw.placements = move.getPlacements();
+        raw.start_row = raw.placements.front().row;
+        raw.start_col = raw.placements.front().col;
+        if (!generator.isValidMove(raw)) {
+            invalid++;
+        }
+    }
+    assert_equal(0, invalid, "No generated move should fail cross-word validation");
+}
+
+int main() {
+    cout << "=== Scradle Engine - Cross Check Tests ===" << endl;
+
+    test_cross_checks_empty_board();
+    test_cross_checks_around_word();
+    test_cross_checks_between_tiles();
+    test_cross_checks_generated_moves_valid();
+
+    print_summary();
+
+    return exit_code();
+}
@@ -1,6 +1,11 @@
 #include "dawg.h"
 #include "test_framework.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <stdexcept>
 
 using namespace scradle;
 using namespace test;
@@ -96,6 +101,8 @@ void test_dawg_load_from_file() {
 
     assert_true(loaded, "DAWG should load successfully from ODS8 file");
     assert_equal(411430, dawg.getWordCount(), "ODS8 should contain 411,430 words");
+    cout << "  " << dawg.getNodeCount() << " nodes, " << dawg.getEdgeCount() << " edges, "
+         << dawg.getByteSize() / 1024 << " KB" << endl;
 
     // Test common French words
     assert_true(dawg.contains("CHAT"), "DAWG should contain 'CHAT'");
@@ -145,6 +152,166 @@ void test_dawg_clear() {
     assert_true(!dawg.contains("CHAT"), "DAWG should not contain 'CHAT' after clear");
 }
 
+void test_dawg_traversal() {
+    cout << "\n" << color::BLUE << color::BOLD << "=== Test: DAWG Traversal ===" << color::RESET << endl;
+
+    DAWG dawg;
+    std::vector<std::string> words = {"CHIEN", "CHAT", "CHATS", "MAISON"};
+
+    dawg.build(words);
+
+    DAWG::NodeIndex ch = dawg.getNodeAt("CH");
+    assert_true(ch != DAWG::NO_NODE, "Node for 'CH' should exist");
+    assert_equal(dawg.getNodeAt("CHA"), dawg.getChild(ch, 'A'), "getChild should follow the 'A' edge");
+    assert_equal(DAWG::NO_NODE, dawg.getChild(ch, 'O'), "getChild should return NO_NODE for a missing letter");
+    assert_equal(DAWG::NO_NODE, dawg.getNodeAt("CHO"), "getNodeAt should return NO_NODE for a missing prefix");
+    assert_true(dawg.isEndOfWord(dawg.getNodeAt("CHAT")), "'CHAT' node should be end of word");
+    assert_false(dawg.isEndOfWord(ch), "'CH' node should not be end of word");
+
+    // Children are packed in sorted order
+    std::string letters;
+    for (const DAWG::Edge* edge = dawg.edgesBegin(ch); edge != dawg.edgesEnd(ch); ++edge) {
+        letters += edge->letter;
+    }
+    assert_equal(std::string("AI"), letters, "Children of 'CH' should be sorted (A, I)");
+
+    // Child mask mirrors the edges; a child is reached by its letter bit
+    uint32_t expected_mask = (1u << DAWG::letterBit('A')) | (1u << DAWG::letterBit('I'));
+    assert_equal(expected_mask, dawg.getChildMask(ch), "Child mask of 'CH' should have bits A and I");
+    assert_equal(dawg.getNodeAt("CHI"), dawg.getChildByBit(ch, DAWG::letterBit('I')),
+                 "getChildByBit should follow the 'I' edge");
+    assert_equal(DAWG::SEPARATOR_BIT, DAWG::letterBit('^'), "Non-letters should map to the separator bit");
+
+    auto cha_words = dawg.getWordsWithPrefix("cha");
+    assert_equal(2, (int)cha_words.size(), "Should find 2 words starting with 'cha'");
+}
+
+void test_dawg_cursor() {
+    cout << "\n" << color::BLUE << color::BOLD << "=== Test: DAWG Cursor ===" << color::RESET << endl;
+
+    DAWG dawg;
+    std::vector<std::string> words = {"CHIEN", "CHAT", "CHATS", "MAISON"};
+
+    dawg.build(words);
+
+    DAWG::Cursor cursor = dawg.cursor();
+    assert_equal(dawg.getRoot(), cursor.index(), "cursor() should start at the root");
+    cursor = cursor.child('C').child('H').child('A').child('T');
+    assert_true(cursor.valid(), "Cursor should follow 'CHAT'");
+    assert_true(cursor.isEndOfWord(), "Cursor at 'CHAT' should be end of word");
+    assert_equal(dawg.getNodeAt("CHAT"), cursor.index(), "Cursor should match getNodeAt");
+
+    DAWG::Cursor copy = cursor;
+    assert_equal(dawg.getNodeAt("CHATS"), copy.childByBit(DAWG::letterBit('S')).index(),
+                 "Copied cursor should traverse independently");
+    assert_false(cursor.child('X').valid(), "Missing letter should give an invalid cursor");
+    assert_false(dawg.cursorAt("CHO").valid(), "cursorAt should be invalid for a missing prefix");
+    assert_equal(dawg.getChildMask(dawg.getNodeAt("CH")), dawg.cursorAt("ch").childMask(),
+                 "cursorAt should be case insensitive");
+}
+
+void test_dawg_minimization() {
+    cout << "\n" << color::BLUE << color::BOLD << "=== Test: DAWG Suffix Minimization ===" << color::RESET << endl;
+
+    DAWG dawg;
+    // A plain trie would need 13 nodes; TAPER/LAPER share the whole "APER(A)" tail
+    std::vector<std::string> words = {"TAPERA", "LAPER", "TAPER", "LAPERA"};
+
+    dawg.build(words);
+
+    assert_equal(4, dawg.getWordCount(), "DAWG should have 4 words");
+    assert_equal(7, dawg.getNodeCount(), "Equivalent suffixes should be merged (7 nodes)");
+    assert_equal(dawg.getNodeAt("TAP"), dawg.getNodeAt("LAP"), "'TAP' and 'LAP' should share a node");
+    assert_true(dawg.contains("LAPERA"), "DAWG should contain 'LAPERA'");
+    assert_false(dawg.contains("LAPE"), "DAWG should not contain 'LAPE'");
+    assert_equal(dawg.getNodeCount() * sizeof(DAWG::Node) + dawg.getEdgeCount() * sizeof(DAWG::Edge),
+                 dawg.getByteSize(), "Byte size should account for nodes and edges");
+}
+
+void test_dawg_binary_roundtrip() {
+    cout << "\n" << color::BLUE << color::BOLD << "=== Test: DAWG Binary Format ===" << color::RESET << endl;
+
+    const std::string filename = "test_dawg_roundtrip.dawg";
+
+    DAWG dawg;
+    std::vector<std::string> words = {"CHAT", "CHATS", "CHIEN", "MAISON", "PORTE"};
+    dawg.build(words);
+    assert_true(dawg.saveBinary(filename), "DAWG should save to a binary file");
+
+    DAWG mapped;
+    assert_true(mapped.loadMapped(filename), "Binary file should be memory-mapped");
+    assert_true(mapped.isMapped(), "Loaded DAWG should report being mapped");
+    assert_equal(dawg.getWordCount(), mapped.getWordCount(), "Mapped DAWG should keep the word count");
+    assert_equal(dawg.getNodeCount(), mapped.getNodeCount(), "Mapped DAWG should keep the node count");
+    assert_true(mapped.contains("CHATS"), "Mapped DAWG should contain 'CHATS'");
+    assert_true(mapped.contains("porte"), "Mapped DAWG should contain 'porte' (case insensitive)");
+    assert_false(mapped.contains("CHA"), "Mapped DAWG should not contain 'CHA'");
+    assert_equal(2, (int)mapped.getWordsWithPrefix("CHAT").size(), "Mapped DAWG should find 2 words starting with 'CHAT'");
+
+    mapped.clear();
+    assert_false(mapped.isMapped(), "Clear should release the mapping");
+    assert_equal(0, mapped.getWordCount(), "Cleared DAWG should have 0 words");
+
+    std::remove(filename.c_str());
+
+    DAWG missing;
+    assert_false(missing.loadMapped("does_not_exist.dawg"), "Mapping a missing file should fail");
+    assert_false(missing.loadMapped("engine/tests/test_dawg.cpp"), "Mapping a non-DAWG file should fail");
+}
+
+void test_dawg_binary_validation() {
+    cout << "\n" << color::BLUE << color::BOLD << "=== Test: DAWG Binary Validation ===" << color::RESET << endl;
+
+    const std::string compiled = "test_dawg_validation.dawg";
+    const std::string word_list = "test_dawg_validation.txt";
+
+    DAWG dawg;
+    dawg.build({"CHAT", "CHATS", "CHIEN"});
+    assert_true(dawg.saveBinary(compiled), "DAWG should save to a binary file");
+
+    // Point the last edge (the end of the file) past the node array
+    {
+        std::fstream file(compiled, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-static_cast<std::streamoff>(sizeof(DAWG::Edge)), std::ios::end);
+        uint32_t target = 1000000;
+        file.write(reinterpret_cast<const char*>(&target), sizeof(target));
+    }
+    DAWG corrupt;
+    bool threw = false;
+    try {
+        corrupt.loadMapped(compiled);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert_true(threw, "Mapping a file with an out-of-range edge should throw");
+    assert_false(corrupt.isMapped(), "A rejected file should not stay mapped");
+
+    // loadDictionary falls back to the word list on a corrupt file...
+    {
+        std::ofstream file(word_list);
+        file << "PORTE\nPORTES\n";
+    }
+    DAWG fallback;
+    assert_true(fallback.loadDictionary(compiled, word_list), "Corrupt compiled file should fall back");
+    assert_true(fallback.contains("PORTES") && !fallback.isMapped(), "Fallback should load the word list");
+
+    // ...and when the word list is newer than the compiled file
+    assert_true(dawg.saveBinary(compiled), "DAWG should save to a binary file");
+    auto compiled_time = std::filesystem::last_write_time(compiled);
+    std::filesystem::last_write_time(word_list, compiled_time + std::chrono::seconds(10));
+    DAWG newer;
+    assert_true(newer.loadDictionary(compiled, word_list), "Newer word list should load");
+    assert_true(newer.contains("PORTE") && !newer.contains("CHAT"), "Newer word list should win");
+
+    std::filesystem::last_write_time(word_list, compiled_time - std::chrono::seconds(10));
+    DAWG older;
+    assert_true(older.loadDictionary(compiled, word_list), "Compiled file should load");
+    assert_true(older.isMapped() && older.contains("CHAT"), "Up-to-date compiled file should win");
+
+    std::remove(compiled.c_str());
+    std::remove(word_list.c_str());
+}
+
 int main() {
     cout << color::MAGENTA << color::BOLD << "=== Scradle Engine - DAWG Tests ===" << color::RESET << endl;
 
@@ -156,6 +323,11 @@ int main() {
     test_dawg_load_from_file();
     test_dawg_case_insensitive();
     test_dawg_clear();
+    test_dawg_traversal();
+    test_dawg_cursor();
+    test_dawg_minimization();
+    test_dawg_binary_roundtrip();
+    test_dawg_binary_validation();
 
     print_summary();
 
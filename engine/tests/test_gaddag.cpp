@@ -0,0 +1,172 @@
+#include <iostream>
+
+#include "board.h"
+#include "dawg.h"
+#include "gaddag.h"
+#include "move.h"
+#include "move_generator.h"
+#include "rack.h"
+#include "test_framework.h"
+
+using namespace scradle;
+using namespace test;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+// Compact description of a move list, in generation order
+static string describeMoves(const vector<Move>& moves) {
+    string result;
+    for (const auto& move : moves) {
+        result += move.toString() + "|";
+        for (const auto& placement : move.getPlacements()) {
+            result += std::to_string(placement.row) + "," + std::to_string(placement.col);
+            result += placement.is_blank ? char(std::tolower(placement.letter)) : placement.letter;
+            result += " ";
+        }
+        result += "\n";
+    }
+    return result;
+}
+
+// Both engines must return the same moves in the same order
+static void assert_same_moves(const Board& board, const string& rack_tiles, const DAWG& dawg,
+                              const GADDAG& gaddag, const string& test_name) {
+    Rack rack(rack_tiles);
+    MoveGenerator start_positions(board, rack, dawg);
+    MoveGenerator anchors(board, rack, dawg, gaddag);
+
+    vector<Move> expected = start_positions.generateMoves();
+    vector<Move> actual = anchors.generateMoves();
+
+    assert_true(!expected.empty(), test_name + " (moves exist)");
+    assert_equal(describeMoves(expected), describeMoves(actual), test_name);
+}
+
+void test_gaddag_paths() {
+    cout << "\n=== Test: GADDAG Paths ===" << endl;
+
+    GADDAG gaddag;
+    gaddag.build({"CAT", "chats"});
+
+    const DAWG& graph = gaddag.getGraph();
+    string sep(1, GADDAG::SEPARATOR);
+
+    assert_true(gaddag.contains("CAT"), "GADDAG should contain 'CAT'");
+    assert_true(gaddag.contains("chats"), "GADDAG should contain 'chats' (case insensitive)");
+    assert_false(gaddag.contains("CHAT"), "GADDAG should not contain 'CHAT'");
+
+    assert_true(graph.contains("C" + sep + "AT"), "'CAT' split after C");
+    assert_true(graph.contains("AC" + sep + "T"), "'CAT' split after A");
+    assert_true(graph.contains("TAC"), "'CAT' fully reversed");
+    assert_true(graph.contains("TAHC" + sep + "S"), "'CHATS' split after T");
+    assert_false(graph.contains("TAC" + sep), "No path ends with a separator");
+}
+
+void test_gaddag_engine_empty_board() {
+    cout << "\n=== Test: Anchor Engine (Empty Board) ===" << endl;
+
+    vector<string> words = {"CAT", "AT", "TA", "ACT", "CHAT", "CHATS", "TACHE", "HATE", "HE", "EH"};
+    DAWG dawg;
+    dawg.build(words);
+    GADDAG gaddag;
+    gaddag.build(words);
+
+    Board board;
+    assert_same_moves(board, "CATHES", dawg, gaddag, "Same moves on empty board");
+    assert_same_moves(board, "CA?E", dawg, gaddag, "Same moves on empty board with a blank");
+}
+
+void test_gaddag_engine_with_tiles() {
+    cout << "\n=== Test: Anchor Engine (With Tiles) ===" << endl;
+
+    vector<string> words = {"CAT", "CATS", "AT", "TA", "ACT", "CHAT", "CHATS", "TACHE", "HATE",
+                            "HE", "EH", "SCAT", "ES", "SE", "TE", "ET", "ETE", "HAT", "HATS"};
+    DAWG dawg;
+    dawg.build(words);
+    GADDAG gaddag;
+    gaddag.build(words);
+
+    Board board = Board::parseBoard(R"(
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        .......CHAT....
+        ..........E....
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ............CAT
+    )");
+
+    assert_same_moves(board, "SATECH?", dawg, gaddag, "Same moves around existing words");
+    assert_same_moves(board, "STE", dawg, gaddag, "Same moves with a short rack");
+}
+
+void test_gaddag_engine_best_move() {
+    cout << "\n=== Test: Anchor Engine (Best Move) ===" << endl;
+
+    vector<string> words = {"CAT", "CATS", "AT", "TA", "ACT", "CHAT", "CHATS", "HATE", "HE", "EH"};
+    DAWG dawg;
+    dawg.build(words);
+    GADDAG gaddag;
+    gaddag.build(words);
+
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'A');
+    board.setLetter(7, 9, 'T');
+
+    Rack rack("HSE");
+    MoveGenerator start_positions(board, rack, dawg);
+    MoveGenerator anchors(board, rack, dawg, gaddag);
+
+    assert_equal(describeMoves(start_positions.getBestMove()), describeMoves(anchors.getBestMove()),
+                 "Same best moves from both engines");
+}
+
+void test_gaddag_engine_parallel() {
+    cout << "\n=== Test: Anchor Engine (Parallel) ===" << endl;
+
+    vector<string> words = {"CAT", "CATS", "AT", "TA", "ACT", "CHAT", "CHATS", "HATE", "HATES", "HE", "EH", "ES", "SE"};
+    DAWG dawg;
+    dawg.build(words);
+    GADDAG gaddag;
+    gaddag.build(words);
+
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'A');
+    board.setLetter(7, 9, 'T');
+
+    Rack rack("HSETA?");
+    MoveGenerator serial(board, rack, dawg);
+    MoveGenerator parallel(board, rack, dawg, gaddag);
+    parallel.setThreads(4);
+
+    assert_equal(describeMoves(serial.generateMoves()), describeMoves(parallel.generateMoves()),
+                 "Parallel anchor engine returns the serial moves");
+    assert_equal(describeMoves(serial.getBestMove()), describeMoves(parallel.getBestMove()),
+                 "Parallel anchor engine returns the serial best moves");
+}
+
+int main() {
+    cout << "=== Scradle Engine - GADDAG Tests ===" << endl;
+
+    test_gaddag_paths();
+    test_gaddag_engine_empty_board();
+    test_gaddag_engine_with_tiles();
+    test_gaddag_engine_best_move();
+    test_gaddag_engine_parallel();
+
+    print_summary();
+
+    return exit_code();
+}
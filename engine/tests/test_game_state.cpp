@@ -1,6 +1,9 @@
 #include <iostream>
+#include <unordered_set>
+#include <utility>
 
 #include "game_state.h"
+#include "move_generator.h"
 #include "test_framework.h"
 
 using namespace scradle;
@@ -165,6 +168,58 @@ void test_game_state_move_history() {
     assert_equal(25, state.getTotalScore(), "Total score should be 25");
 }
 
+// Number of squares where `checks` differs from a table built from scratch
+static int countStaleSquares(const GameState& state, const DAWG& dawg) {
+    CrossChecks fresh;
+    fresh.compute(state.getBoard(), dawg);
+    const CrossChecks& checks = *state.getCrossChecks();
+
+    int stale = 0;
+    for (int row = 0; row < Board::SIZE; row++) {
+        for (int col = 0; col < Board::SIZE; col++) {
+            if (checks.get(row, col, Direction::HORIZONTAL) != fresh.get(row, col, Direction::HORIZONTAL) ||
+                checks.get(row, col, Direction::VERTICAL) != fresh.get(row, col, Direction::VERTICAL) ||
+                checks.isAnchor(row, col) != fresh.isAnchor(row, col)) {
+                stale++;
+            }
+        }
+    }
+    return stale;
+}
+
+void test_game_state_cross_checks() {
+    cout << "\n"
+         << color::BLUE << color::BOLD << "=== Test: GameState Cross Checks ===" << color::RESET << endl;
+
+    DAWG dawg;
+    dawg.build({"CAT", "CATS", "AT", "TA", "ET", "TE", "SA", "AS", "SET", "TAS"});
+
+    GameState state(77);
+    assert_true(state.getCrossChecks() == nullptr, "No cross checks before a dictionary is set");
+    state.setDictionary(dawg);
+    assert_true(state.getCrossChecks() != nullptr, "Cross checks available once a dictionary is set");
+
+    Move cat(7, 7, Direction::HORIZONTAL, "CAT");
+    cat.addPlacement(TilePlacement(7, 7, 'C'));
+    cat.addPlacement(TilePlacement(7, 8, 'A'));
+    cat.addPlacement(TilePlacement(7, 9, 'T'));
+    state.applyMove(cat);
+    assert_equal(0, countStaleSquares(state, dawg), "Cross checks should match the board after CAT");
+    assert_true(state.getCrossChecks()->isAnchor(6, 8), "Square above A should be an anchor");
+
+    Move et(6, 9, Direction::VERTICAL, "ET");
+    et.addPlacement(TilePlacement(6, 9, 'E'));
+    state.applyMove(et);
+    assert_equal(0, countStaleSquares(state, dawg), "Cross checks should match the board after ET");
+
+    state.undoLastMove();
+    assert_equal(0, countStaleSquares(state, dawg), "Cross checks should match the board after undo");
+
+    state.reset();
+    assert_equal(0, countStaleSquares(state, dawg), "Cross checks should match the board after reset");
+    assert_false(state.getCrossChecks()->isAnchor(6, 8), "Reset board should have no anchors");
+}
+
 void test_rack_validity_before_move_15() {
     cout << "\n"
          << color::BLUE << color::BOLD << "=== Test: Rack Validity Before Move 15 ===" << color::RESET << endl;
@@ -250,6 +305,95 @@ void test_refill_rack_handles_invalid_racks() {
     }
 }
 
+void test_game_state_hash() {
+    cout << "\n"
+         << color::BLUE << color::BOLD << "=== Test: GameState Zobrist Hash ===" << color::RESET << endl;
+
+    // Boards: the same letters in any order hash alike, blanks apart
+    Board first;
+    Board second;
+    first.setLetter(7, 7, 'C');
+    first.setLetter(7, 8, 'A');
+    second.setLetter(7, 8, 'A');
+    second.setLetter(7, 7, 'C');
+    assert_equal(first.hash(), second.hash(), "Placement order should not change the board hash");
+    second.setLetter(7, 8, 'a');
+    assert_true(first.hash() != second.hash(), "A blank should hash apart from its letter");
+    first.setLetter(7, 7, ' ');
+    first.setLetter(7, 8, ' ');
+    assert_equal((uint64_t)0, first.hash(), "An emptied board should hash as a new one");
+
+    // Racks hash as multisets
+    Rack rack("CAAT");
+    assert_equal(Rack("TACA").hash(), rack.hash(), "Tile order should not change the rack hash");
+    assert_true(Rack("CAT").hash() != rack.hash(), "The number of copies should count");
+    rack.removeTile('A');
+    rack.addTile('a');
+    assert_equal(Rack("CAAT").hash(), rack.hash(), "Remove then add should restore the rack hash");
+
+    // Every copy has its own key, well past the copies of any one tile in the
+    // bag: a rack of n E's never hashes like a smaller one
+    std::unordered_set<uint64_t> copy_hashes;
+    for (int n = 0; n <= 2 * TileBag::TOTAL_TILES; n++) {
+        copy_hashes.insert(Rack(std::string(n, 'E')).hash());
+    }
+    assert_equal((size_t)(2 * TileBag::TOTAL_TILES + 1), copy_hashes.size(), "Adding copies of a tile should always change the rack hash");
+
+    // Bags: drawing and returning tiles restores the hash
+    TileBag bag(7);
+    uint64_t full = bag.hash();
+    assert_equal(TileBag(8).hash(), full, "Full bags should hash alike whatever the seed");
+    std::string drawn = bag.drawTiles(7);
+    assert_true(bag.hash() != full, "Drawing should change the bag hash");
+    bag.returnTiles(drawn);
+    assert_equal(full, bag.hash(), "Returning the tiles should restore the bag hash");
+
+    // Game states: board, rack and bag together
+    GameState state(42);
+    uint64_t initial = state.hash();
+    state.refillRack();
+    uint64_t refilled = state.hash();
+    assert_true(refilled != initial, "Drawing a rack should change the state hash");
+
+    std::string tiles = state.getRack().getTiles();
+    Move move(7, 7, Direction::HORIZONTAL, tiles.substr(0, 2));
+    move.addPlacement(TilePlacement(7, 7, tiles[0], true, tiles[0] == '?'));
+    move.addPlacement(TilePlacement(7, 8, tiles[1], true, tiles[1] == '?'));
+    state.applyMove(move);
+    assert_true(state.hash() != refilled, "Playing tiles should change the state hash");
+    state.undoLastMove();
+    assert_equal(refilled, state.hash(), "Undoing a move should restore the state hash");
+
+    state.reset();
+    assert_equal(initial, state.hash(), "Reset should restore the initial hash");
+}
+
+void test_game_state_best_move_generator() {
+    cout << "\n"
+         << color::BLUE << color::BOLD << "=== Test: GameState Best Move Generator ===" << color::RESET << endl;
+
+    DAWG dawg;
+    dawg.build({"CAT", "CATS", "AT", "TA", "ET", "TE", "SA", "AS", "SET", "TAS", "ACTE", "ACTES"});
+
+    // Each state plays on its own board with its own generator
+    GameState first(1);
+    GameState second(2);
+    first.getRack().setTiles("CATS");
+    second.getRack().setTiles("SET");
+    assert_true(first.findAndPlayBestMove(dawg), "First state should find a move");
+    assert_true(second.findAndPlayBestMove(dawg), "Second state should find a move");
+    assert_equal(std::string("CATS"), first.getMoveHistory().back().getWord(), "First state should play CATS");
+    assert_equal(std::string("SET"), second.getMoveHistory().back().getWord(), "Second state should play SET");
+
+    // A moved state keeps playing on its own board
+    GameState moved(std::move(first));
+    moved.getRack().setTiles("AE");
+    std::vector<Move> expected = MoveGenerator(moved.getBoard(), moved.getRack(), dawg).getBestMove();
+    assert_true(moved.findAndPlayBestMove(dawg), "Moved state should find a move");
+    assert_equal(expected[0].toString(), moved.getMoveHistory().back().toString(),
+                 "Moved state should play the best move on its board");
+}
+
 int main() {
     cout << "=== GameState Tests ===" << endl;
 
@@ -260,9 +404,12 @@ int main() {
     test_game_state_is_game_over();
     test_game_state_reset();
     test_game_state_move_history();
+    test_game_state_cross_checks();
     test_rack_validity_before_move_15();
     test_rack_validity_after_move_15();
     test_refill_rack_handles_invalid_racks();
+    test_game_state_hash();
+    test_game_state_best_move_generator();
 
     print_summary();
     return exit_code();
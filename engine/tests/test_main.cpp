@@ -7,6 +7,7 @@ using namespace scradle;
 using namespace test;
 using std::cout;
 using std::endl;
+using std::string;
 
 void test_board_creation() {
     cout << "\n=== Test: Board Creation ===" << endl;
@@ -137,12 +138,64 @@ void test_cell_properties() {
     assert_equal(PremiumType::DOUBLE_WORD, letter_cell.premium, "Cell should have double word premium");
 }
 
+void test_board_occupancy_masks() {
+    cout << "\n=== Test: Board Occupancy Masks ===" << endl;
+
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'a');
+    board.setLetter(8, 7, 'T');
+
+    assert_equal((uint16_t)0x0180, board.rowOccupancy(7), "Row 8 should hold H8 and I8");
+    assert_equal((uint16_t)0x0180, board.columnOccupancy(7), "Column H should hold H8 and H9");
+    assert_equal((uint16_t)0x0080, board.rowOccupancy(8), "Row 9 should hold H9");
+
+    // Row 8: G8 and J8 beside the word, H8 above H9, I8 above nothing
+    assert_equal((uint16_t)0x03C0, board.rowAnchors(7), "Row 8 anchors should be G8 to J8");
+    assert_true(board.isAnchor(6, 8), "I7 should be an anchor (above I8)");
+    assert_true(board.isAnchor(8, 8), "I9 should be an anchor (beside H9)");
+    assert_true(!board.isAnchor(9, 8), "I10 should not be an anchor");
+    assert_equal(board.isAnchor(9, 7), (board.columnAnchors(7) >> 9 & 1) == 1,
+                 "Column anchors should agree with isAnchor");
+
+    board.setLetter(8, 7, ' ');
+    assert_equal((uint16_t)0, board.rowOccupancy(8), "Clearing a square should clear its bit");
+    assert_equal((uint16_t)0x0080, board.columnOccupancy(7), "Column H should only hold H8");
+
+    Board copy = board;
+    assert_equal((uint16_t)0x0180, copy.rowOccupancy(7), "Copies should keep the masks");
+}
+
+void test_board_lines() {
+    cout << "\n=== Test: Board Lines ===" << endl;
+
+    Board board;
+    board.setLetter(3, 5, 'Q');
+    board.setLetter(3, 6, 'i');
+    board.setLetter(4, 5, 'U');
+
+    const char* row = board.line(Direction::HORIZONTAL, 3);
+    const char* col = board.line(Direction::VERTICAL, 5);
+    assert_equal(string("     Qi         "), string(row, Board::LINE_STRIDE), "Row 4 should read as one line");
+    assert_equal(string("   QU           "), string(col, Board::LINE_STRIDE), "Column F should read as one line");
+    assert_equal(board.columnOccupancy(6), board.lineOccupancy(Direction::VERTICAL, 6),
+                 "Line occupancy should match the column mask");
+
+    board.setLetter(3, 6, ' ');
+    assert_equal(' ', board.line(Direction::VERTICAL, 6)[3], "Clearing a square should clear both copies");
+
+    StartPosition after_qu(5, 5, Direction::VERTICAL, 1, 7);
+    assert_equal(string("QU"), board.getExistingPrefix(after_qu), "Prefix should come from the column line");
+}
+
 int main() {
     cout << "=== Scradle Engine - Phase 1 Tests ===" << endl;
 
     test_board_creation();
     test_board_premium_squares();
     test_board_letter_placement();
+    test_board_occupancy_masks();
+    test_board_lines();
     test_rack_creation();
     test_rack_operations();
     test_rack_duplicate_letters();
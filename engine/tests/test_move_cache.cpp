@@ -0,0 +1,202 @@
+#include <bitset>
+#include <iostream>
+
+#include "board.h"
+#include "dawg.h"
+#include "move.h"
+#include "move_cache.h"
+#include "move_generator.h"
+#include "rack.h"
+#include "test_framework.h"
+#include "zobrist.h"
+
+using namespace scradle;
+using namespace test;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+static const vector<string> WORDS = {"CAT", "CATS", "SCAT", "ACT", "ACTS", "AT",
+                                     "TA",  "AS",   "TAS",  "SAC", "CASA", "ACTA"};
+
+static bool sameMoves(const vector<Move>& a, const vector<Move>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].toString() != b[i].toString()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_cache_hits_and_misses() {
+    cout << "\n=== Test: Move Cache Hits And Misses ===" << endl;
+
+    DAWG dawg;
+    dawg.build(WORDS);
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'A');
+    board.setLetter(7, 9, 'T');
+
+    MoveCache cache;
+    MoveGenerator plain(board, Rack("SATC"), dawg);
+    vector<Move> expected_best = plain.getBestMove();
+    vector<Move> expected_top = plain.getTopMoves(5);
+
+    MoveGenerator gen(board, Rack("SATC"), dawg);
+    gen.setCache(&cache);
+    assert_true(sameMoves(expected_best, gen.getBestMove()), "First best-move query should search");
+    assert_true(sameMoves(expected_best, gen.getBestMove()), "Second best-move query should match");
+    assert_true(sameMoves(expected_top, gen.getTopMoves(5)), "Top moves should be cached separately");
+    assert_equal((uint64_t)1, cache.hits(), "One query should have hit");
+    assert_equal((uint64_t)2, cache.misses(), "Two queries should have missed");
+
+    // Same tiles in another order
+    MoveGenerator shuffled(board, Rack("CTAS"), dawg);
+    shuffled.setCache(&cache);
+    assert_true(sameMoves(expected_top, shuffled.getTopMoves(5)), "Shuffled rack should hit the same entry");
+    assert_equal((uint64_t)2, cache.hits(), "Shuffled rack should count as a hit");
+
+    // Another board must not hit
+    Board other = board;
+    other.setLetter(8, 9, 'A');
+    MoveGenerator moved(other, Rack("SATC"), dawg);
+    moved.setCache(&cache);
+    moved.getBestMove();
+    assert_equal((uint64_t)3, cache.misses(), "A different board should miss");
+    assert_equal((size_t)3, cache.size(), "Three entries should be stored");
+}
+
+void test_cache_eviction() {
+    cout << "\n=== Test: Move Cache Eviction ===" << endl;
+
+    DAWG dawg;
+    dawg.build(WORDS);
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'A');
+    board.setLetter(7, 9, 'T');
+
+    MoveCache cache(2);
+    vector<Move> moves;
+    cache.store(board, MoveGenerator::countLetters("A"), MoveCache::BEST_MOVES, moves);
+    cache.store(board, MoveGenerator::countLetters("S"), MoveCache::BEST_MOVES, moves);
+    assert_true(cache.lookup(board, MoveGenerator::countLetters("A"), MoveCache::BEST_MOVES, moves),
+                "Entry A should be cached");
+
+    // S is now the least recently used
+    cache.store(board, MoveGenerator::countLetters("T"), MoveCache::BEST_MOVES, moves);
+    assert_equal((size_t)2, cache.size(), "Cache should stay at capacity");
+    assert_true(cache.lookup(board, MoveGenerator::countLetters("A"), MoveCache::BEST_MOVES, moves),
+                "Recently used entry should survive");
+    assert_true(!cache.lookup(board, MoveGenerator::countLetters("S"), MoveCache::BEST_MOVES, moves),
+                "Least recently used entry should be evicted");
+
+    cache.clear();
+    assert_equal((size_t)0, cache.size(), "Clear should drop every entry");
+}
+
+void test_cache_shared_between_threads() {
+    cout << "\n=== Test: Move Cache Shared Between Threads ===" << endl;
+
+    DAWG dawg;
+    dawg.build(WORDS);
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'A');
+    board.setLetter(7, 9, 'T');
+
+    const vector<string> racks = {"SATC", "AST", "CAS", "TAC"};
+    vector<vector<Move>> expected;
+    for (const string& rack : racks) {
+        MoveGenerator gen(board, Rack(rack), dawg);
+        expected.push_back(gen.getTopMoves(3));
+    }
+
+    MoveCache cache;
+    const int queries = 64;
+    int mismatches = 0;
+#pragma omp parallel for reduction(+ : mismatches)
+    for (int i = 0; i < queries; i++) {
+        MoveGenerator gen(board, Rack(racks[i % racks.size()]), dawg);
+        gen.setCache(&cache);
+        if (!sameMoves(expected[i % racks.size()], gen.getTopMoves(3))) {
+            mismatches++;
+        }
+    }
+    assert_equal(0, mismatches, "Every thread should get the uncached result");
+    assert_equal((uint64_t)queries, cache.hits() + cache.misses(), "Every query should be counted");
+    assert_equal(racks.size(), cache.size(), "One entry per rack");
+}
+
+// A board whose Zobrist hash equals the empty board's: 65 keys of 64 bits
+// are linearly dependent, so some set of 'A' tiles among the first 65
+// squares XORs to zero
+static Board collidingBoard() {
+    const int count = 65;
+    std::vector<uint64_t> basis;
+    std::vector<std::bitset<count>> used;
+    for (int square = 0; square < count; square++) {
+        uint64_t key = zobrist::squareKey(square, 'A');
+        std::bitset<count> squares;
+        squares.set(square);
+        for (size_t i = 0; i < basis.size(); i++) {
+            if ((key ^ basis[i]) < key) {
+                key ^= basis[i];
+                squares ^= used[i];
+            }
+        }
+        if (key == 0) {
+            Board board;
+            for (int s = 0; s < count; s++) {
+                if (squares.test(s)) {
+                    board.setLetter(s / Board::SIZE, s % Board::SIZE, 'A');
+                }
+            }
+            return board;
+        }
+        basis.push_back(key);
+        used.push_back(squares);
+        // Keep the basis sorted by leading bit, highest first
+        for (size_t i = basis.size() - 1; i > 0 && basis[i] > basis[i - 1]; i--) {
+            std::swap(basis[i], basis[i - 1]);
+            std::swap(used[i], used[i - 1]);
+        }
+    }
+    return Board();
+}
+
+void test_cache_hash_collision() {
+    cout << "\n=== Test: Move Cache Hash Collision ===" << endl;
+
+    Board empty;
+    Board colliding = collidingBoard();
+    assert_true(!colliding.isBoardEmpty(), "Colliding board should hold tiles");
+    assert_equal(empty.hash(), colliding.hash(), "Colliding board should share the empty board's hash");
+
+    MoveCache cache;
+    vector<Move> moves = {Move(7, 7, Direction::HORIZONTAL, "CAT")};
+    cache.store(empty, MoveGenerator::countLetters("CAT"), MoveCache::BEST_MOVES, moves);
+    vector<Move> found;
+    assert_true(!cache.lookup(colliding, MoveGenerator::countLetters("CAT"), MoveCache::BEST_MOVES, found),
+                "A board with the same hash should miss");
+    assert_true(cache.lookup(empty, MoveGenerator::countLetters("CAT"), MoveCache::BEST_MOVES, found),
+                "The stored board should still hit");
+}
+
+int main() {
+    cout << "=== Scradle Engine - Move Cache Tests ===" << endl;
+
+    test_cache_hits_and_misses();
+    test_cache_eviction();
+    test_cache_shared_between_threads();
+    test_cache_hash_collision();
+
+    print_summary();
+
+    return exit_code();
+}
@@ -0,0 +1,195 @@
+#include <iostream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "board.h"
+#include "dawg.h"
+#include "game_state.h"
+#include "move.h"
+#include "move_code.h"
+#include "move_generator.h"
+#include "rack.h"
+#include "scorer.h"
+#include "test_framework.h"
+
+using namespace scradle;
+using namespace test;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+// Copy of `board` with the move's rack tiles placed
+static Board playOn(const Board& board, const Move& move) {
+    Board after = board;
+    for (const auto& placement : move.getPlacements()) {
+        after.setLetter(placement.row, placement.col, placement.letter);
+    }
+    return after;
+}
+
+static bool samePlacements(const Move& a, const Move& b) {
+    if (a.getPlacements().size() != b.getPlacements().size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.getPlacements().size(); i++) {
+        const TilePlacement& pa = a.getPlacements()[i];
+        const TilePlacement& pb = b.getPlacements()[i];
+        if (pa.row != pb.row || pa.col != pb.col || pa.letter != pb.letter || pa.is_blank != pb.is_blank ||
+            pa.is_from_rack != pb.is_from_rack) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_move_code_round_trip() {
+    cout << "\n=== Test: Move Code Round Trip ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"CAT", "CATS", "SCAT", "AT", "TA", "AS", "TAS", "SAC", "CASA", "ACTA"});
+
+    Board board;
+    board.setLetter(7, 6, 'C');
+    board.setLetter(7, 7, 'A');
+    board.setLetter(7, 8, 'T');
+
+    MoveGenerator gen(board, Rack("SAT?"), dawg);
+    vector<Move> moves = gen.generateMoves();
+    assert_true(moves.size() > 10, "Should generate moves to encode");
+
+    int mismatches = 0;
+    for (const Move& move : moves) {
+        MoveCode code = MoveCode::encode(move);
+        Move decoded = code.decode(playOn(board, move));
+        if (decoded.getWord() != move.getWord() || decoded.getStartRow() != move.getStartRow() ||
+            decoded.getStartCol() != move.getStartCol() || decoded.getDirection() != move.getDirection() ||
+            decoded.getScore() != move.getScore() || !samePlacements(decoded, move)) {
+            mismatches++;
+        }
+        // Without a board: the same tiles, and the same code again
+        if (!samePlacements(code.decode(), move) || MoveCode::encode(code.decode()) != code) {
+            mismatches++;
+        }
+    }
+    assert_equal(0, mismatches, "Every generated move should decode back to itself");
+}
+
+void test_move_code_fields() {
+    cout << "\n=== Test: Move Code Fields ===" << endl;
+
+    Move move(2, 4, Direction::VERTICAL, "CASE");
+    move.addPlacement(TilePlacement(2, 4, 'C'));
+    move.addPlacement(TilePlacement(4, 4, 'S', true, true));
+    move.addPlacement(TilePlacement(5, 4, 'E'));
+    move.setScore(1234);
+
+    MoveCode code = MoveCode::encode(move);
+    assert_equal(Direction::VERTICAL, code.getDirection(), "Direction should be kept");
+    assert_equal(4, code.getLine(), "Column should be kept as the line");
+    assert_equal((1 << 2) | (1 << 4) | (1 << 5), code.getSquares(), "Placed squares should be kept");
+    assert_equal(3, code.getTileCount(), "Three tiles came from the rack");
+    assert_true(!code.isBingo(), "Three tiles is not a bingo");
+    assert_equal(code.value(), MoveCode(code.value()).value(), "Raw value should round trip");
+
+    Move tiles = code.decode();
+    assert_equal(2, tiles.getStartRow(), "Tiles should start at the first placed square");
+    assert_equal(4, tiles.getStartCol(), "Tiles should start at the first placed square");
+    assert_equal(string("CSE"), tiles.getWord(), "Tiles alone should spell the placed letters");
+    assert_true(samePlacements(move, tiles), "Letters and blanks should decode without a board");
+
+    Move bingo(7, 4, Direction::HORIZONTAL, "ZYMURGY");
+    for (int i = 0; i < 7; i++) {
+        bingo.addPlacement(TilePlacement(7, 4 + i, "ZYMURGY"[i], true, i == 6));
+    }
+    MoveCode bingo_code = MoveCode::encode(bingo);
+    assert_true(bingo_code.isBingo(), "Seven tiles is a bingo");
+    assert_true(samePlacements(bingo, bingo_code.decode()), "Seven letters should fit in the code");
+
+    Move too_many = bingo;
+    too_many.addPlacement(TilePlacement(7, 11, 'S'));
+    bool threw = false;
+    try {
+        MoveCode::encode(too_many);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert_true(threw, "More tiles than a rack holds should throw");
+}
+
+void test_move_code_letters() {
+    cout << "\n=== Test: Move Code Letters ===" << endl;
+
+    // Same squares and same score, different letters
+    Move cat(7, 7, Direction::HORIZONTAL, "CAT");
+    cat.addPlacement(TilePlacement(7, 7, 'C'));
+    cat.addPlacement(TilePlacement(7, 8, 'A'));
+    cat.addPlacement(TilePlacement(7, 9, 'T'));
+    Move bat(7, 7, Direction::HORIZONTAL, "BAT");
+    bat.addPlacement(TilePlacement(7, 7, 'B'));
+    bat.addPlacement(TilePlacement(7, 8, 'A'));
+    bat.addPlacement(TilePlacement(7, 9, 'T'));
+    Board board;
+    Scorer scorer;
+    cat.setScore(scorer.scoreMove(board, cat));
+    bat.setScore(scorer.scoreMove(board, bat));
+    assert_equal(cat.getScore(), bat.getScore(), "CAT and BAT should score alike");
+    assert_true(MoveCode::encode(cat) != MoveCode::encode(bat), "Different letters should change the code");
+
+    // Same letters, one of them a blank
+    Move blank_cat(7, 7, Direction::HORIZONTAL, "CAT");
+    blank_cat.addPlacement(TilePlacement(7, 7, 'C'));
+    blank_cat.addPlacement(TilePlacement(7, 8, 'A', true, true));
+    blank_cat.addPlacement(TilePlacement(7, 9, 'T'));
+    assert_true(MoveCode::encode(cat) != MoveCode::encode(blank_cat), "A blank should change the code");
+
+    Move down(7, 7, Direction::VERTICAL, "CAT");
+    down.addPlacement(TilePlacement(7, 7, 'C'));
+    down.addPlacement(TilePlacement(8, 7, 'A'));
+    down.addPlacement(TilePlacement(9, 7, 'T'));
+    assert_true(MoveCode::encode(cat) != MoveCode::encode(down), "Direction should change the code");
+
+    std::unordered_set<MoveCode> seen = {MoveCode::encode(cat), MoveCode::encode(bat), MoveCode::encode(blank_cat),
+                                         MoveCode::encode(down), MoveCode::encode(cat)};
+    assert_equal(4, (int)seen.size(), "Hash set should dedupe equal codes");
+}
+
+void test_game_state_history_codes() {
+    cout << "\n=== Test: Game State History Codes ===" << endl;
+
+    GameState state(7);
+    state.getRack().setTiles("CAT?");
+
+    Move move(7, 6, Direction::HORIZONTAL, "CATS");
+    move.addPlacement(TilePlacement(7, 6, 'C'));
+    move.addPlacement(TilePlacement(7, 7, 'A'));
+    move.addPlacement(TilePlacement(7, 8, 'T'));
+    move.addPlacement(TilePlacement(7, 9, 'S', true, true));
+    move.setScore(10);
+    state.applyMove(move);
+
+    assert_equal(1, (int)state.getMoveCodes().size(), "History should hold one code");
+    vector<Move> history = state.getMoveHistory();
+    assert_equal(string("CATS"), history[0].getWord(), "Decoded word should be read from the board");
+    assert_true(history[0].getPlacements()[3].is_blank, "Decoded blank should be kept");
+    assert_equal(10, history[0].getScore(), "Decoded score should be kept");
+
+    state.undoLastMove();
+    assert_true(state.getBoard().isBoardEmpty(), "Undo should clear the tiles");
+    assert_equal(4, state.getRack().size(), "Undo should return the tiles");
+    assert_true(state.getRack().hasTile('?'), "Undo should return the blank as a blank");
+    assert_equal(0, state.getTotalScore(), "Undo should take back the score");
+}
+
+int main() {
+    cout << "=== Scradle Engine - Move Code Tests ===" << endl;
+
+    test_move_code_round_trip();
+    test_move_code_fields();
+    test_move_code_letters();
+    test_game_state_history_codes();
+
+    print_summary();
+
+    return exit_code();
+}
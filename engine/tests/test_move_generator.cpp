@@ -1,11 +1,13 @@
 #include <algorithm>
 #include <iostream>
+#include <stdexcept>
 
 #include "board.h"
 #include "dawg.h"
 #include "move.h"
 #include "move_generator.h"
 #include "rack.h"
+#include "scorer.h"
 #include "test_framework.h"
 
 using namespace scradle;
@@ -15,6 +17,30 @@ using std::endl;
 using std::string;
 using std::vector;
 
+// Dictionary of the search tests played around CHAT
+static const vector<string> CHAT_WORDS = {"CHAT", "CHATS", "CHATTE", "CHATTES", "ET", "TE", "AS", "SA", "ES",
+                                          "TA", "AN", "NA", "HA", "AH", "THE", "ETA", "TES", "SET", "ANS",
+                                          "NAS", "HATE", "HATES", "ENTASSA", "TENTAS", "ZA", "AZ"};
+
+// CHAT across the center, from H8
+static Board chatBoard() {
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'H');
+    board.setLetter(7, 9, 'A');
+    board.setLetter(7, 10, 'T');
+    return board;
+}
+
+// One line per move, with its score, to compare move lists
+static string describe(const vector<Move>& moves) {
+    string result;
+    for (const auto& move : moves) {
+        result += move.toString() + " " + std::to_string(move.getScore()) + "\n";
+    }
+    return result;
+}
+
 void test_move_structure() {
     cout << "\n=== Test: Move Structure ===" << endl;
 
@@ -29,6 +55,41 @@ void test_move_structure() {
     assert_equal(42, move.getScore(), "Score should be 42");
 }
 
+void test_move_full_row_copy() {
+    cout << "\n=== Test: Move Full Row Copy ===" << endl;
+
+    Move move(3, 0, Direction::HORIZONTAL, "ANTICONSTITUTIO");
+    for (int col = 0; col < Move::MAX_LENGTH; col++) {
+        move.addPlacement(TilePlacement(3, col, move.getWord()[col], col % 2 == 0, col == 5));
+    }
+    move.setScore(99);
+
+    Move copy = move;
+    assert_equal(string("ANTICONSTITUTIO"), copy.getWord(), "Copy should keep the whole word");
+    assert_equal(Move::MAX_LENGTH, (int)copy.getPlacements().size(), "Copy should keep every placement");
+    assert_equal(14, (int)copy.getPlacements().back().col, "Last placement should be on column 14");
+    assert_true(copy.getPlacements()[5].is_blank, "Blank flag should survive the copy");
+    assert_equal(99, copy.getScore(), "Score should survive the copy");
+
+    // One letter or placement more than a line holds is rejected
+    bool long_word_rejected = false;
+    try {
+        Move too_long(3, 0, Direction::HORIZONTAL, "ANTICONSTITUTION");
+    } catch (const std::runtime_error&) {
+        long_word_rejected = true;
+    }
+    assert_true(long_word_rejected, "A 16-letter word should throw");
+
+    bool extra_placement_rejected = false;
+    try {
+        copy.addPlacement(TilePlacement(3, 14, 'N'));
+    } catch (const std::runtime_error&) {
+        extra_placement_rejected = true;
+    }
+    assert_true(extra_placement_rejected, "A 16th placement should throw");
+    assert_equal(Move::MAX_LENGTH, (int)copy.getPlacements().size(), "A rejected placement should not be kept");
+}
+
 void test_start_positions_empty_board() {
     cout << "\n=== Test: Start Positions (Empty Board) ===" << endl;
 
@@ -664,35 +725,35 @@ void test_is_valid_move_cross_words() {
     board.setLetter(6, 9, 'M');
 
     MoveGenerator generator(board, rack, dawg);
+
+    // RAT down column 8 fills both gaps (ARM and CAT)
+    RawMove rat_move;
+    rat_move.direction = Direction::VERTICAL;
+    rat_move.start_row = 6;
+    rat_move.start_col = 8;
+    rat_move.placements = {TilePlacement(6, 8, 'R'), TilePlacement(7, 8, 'A'), TilePlacement(8, 8, 'T')};
+
+    assert_equal(string("RAT"), generator.getMainWord(rat_move), "Main word should be RAT");
+    vector<string> cross_words = generator.getCrossWords(rat_move);
+    bool has_arm = false;
+    bool has_cat = false;
+    for (const auto& cw : cross_words) {
+        if (cw == "ARM") has_arm = true;
+        if (cw == "CAT") has_cat = true;
+    }
+    assert_true(has_arm && has_cat, "RAT move should form ARM and CAT");
+    assert_false(generator.isValidMove(rat_move), "RAT move should be invalid (ARM not in DAWG)");
+
+    // Cross-checks keep the move from being generated at all
     auto positions = generator.findStartPositions();
     auto raw_moves = generator.generateRawMoves(positions);
-
-    // Look for the RAT move (should be invalid because ARM cross-word is not in DAWG)
     bool found_rat_move = false;
     for (const auto& raw_move : raw_moves) {
-        string main_word = generator.getMainWord(raw_move);
-        if (main_word == "RAT" && raw_move.placements.size() == 3) {
-            vector<string> cross_words = generator.getCrossWords(raw_move);
-
-            // Should have ARM and CAT as cross-words
-            bool has_arm = false;
-            bool has_cat = false;
-            for (const auto& cw : cross_words) {
-                if (cw == "ARM") has_arm = true;
-                if (cw == "CAT") has_cat = true;
-            }
-
-            if (has_arm && has_cat) {
-                // This is the move we're testing - should be invalid because ARM is not in DAWG
-                found_rat_move = true;
-                bool is_valid = generator.isValidMove(raw_move);
-                assert_false(is_valid, "RAT move should be invalid (ARM not in DAWG)");
-                break;
-            }
+        if (generator.getMainWord(raw_move) == "RAT" && raw_move.placements.size() == 3) {
+            found_rat_move = true;
         }
     }
-
-    assert_true(found_rat_move, "Should find RAT move to test");
+    assert_false(found_rat_move, "RAT move should not be generated");
 }
 
 void test_is_valid_move_all_valid() {
@@ -743,6 +804,305 @@ void test_is_valid_move_all_valid() {
     assert_true(found_valid_rat, "RAT move should be valid (all words in DAWG)");
 }
 
+void test_generated_scores_match_scorer() {
+    cout << "\n=== Test: Generated Scores Match Scorer ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"CHAT", "CHATS", "CHATTE", "ET", "TE", "AS", "SA", "ES", "TA", "AN", "NA", "HA", "AH",
+                "THE", "ETA", "TES", "SET", "ANS", "NAS", "HATE", "HATES", "ENTASSA", "TENTAS"});
+
+    // Lowercase = blank on the board (scores 0 in every word it belongs to)
+    Board board = Board::parseBoard(R"(
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        .......CHAt....
+        ........A......
+        ........T......
+        ........E......
+        ...............
+        ...............
+        ...............
+        ...............
+    )");
+
+    Scorer scorer;
+    vector<string> racks = {"SENAT?E", "ANSSATE", "TE?"};
+    for (const string& tiles : racks) {
+        Rack rack(tiles);
+        MoveGenerator generator(board, rack, dawg);
+        vector<Move> moves = generator.generateMoves();
+        assert_true(!moves.empty(), "Moves should be generated for rack " + tiles);
+
+        int mismatches = 0;
+        for (const auto& move : moves) {
+            if (move.getScore() != scorer.scoreMove(board, move)) {
+                mismatches++;
+            }
+        }
+        assert_equal(0, mismatches, "Running scores should match Scorer for rack " + tiles);
+    }
+}
+
+void test_for_each_move_visitor() {
+    cout << "\n=== Test: forEachMove Visitor ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"CHAT", "CHATS", "ET", "TE", "AS", "SA", "ES", "TA", "THE", "ETA", "TES", "SET", "HATES"});
+
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'H');
+    board.setLetter(7, 9, 'A');
+    board.setLetter(7, 10, 'T');
+
+    Rack rack("SETA?");
+    MoveGenerator generator(board, rack, dawg);
+    vector<Move> moves = generator.generateMoves();
+
+    // Visited moves are the generated moves, in the same order
+    int index = 0;
+    int mismatches = 0;
+    generator.forEachMove([&](const MoveView& view) {
+        Move move = generator.toMove(view);
+        if (index >= (int)moves.size() || move.toString() != moves[index].toString() ||
+            move.getScore() != moves[index].getScore() ||
+            view.tile_count != (int)moves[index].getPlacements().size()) {
+            mismatches++;
+        }
+        index++;
+    });
+    assert_equal((int)moves.size(), index, "forEachMove should visit every generated move");
+    assert_equal(0, mismatches, "Visited moves should match generateMoves");
+
+    // A visitor can keep its own summary without materializing moves
+    int best = 0;
+    generator.forEachMove([&best](const MoveView& view) { best = std::max(best, view.score); });
+    vector<Move> best_moves = generator.getBestMove();
+    assert_true(!best_moves.empty(), "Best moves should be found");
+    assert_equal(best, best_moves[0].getScore(), "Visited best score should match getBestMove");
+    assert_equal(best, generator.getTopMoves(1)[0].getScore(), "Visited best score should match getTopMoves");
+}
+
+void test_best_move_matches_full_search() {
+    cout << "\n=== Test: Best-Only Search Matches Full Search ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"CHAT", "CHATS", "CHATTE", "CHATTES", "ET", "TE", "AS", "SA", "ES", "TA", "AN", "NA", "HA", "AH",
+                "THE", "ETA", "TES", "SET", "ANS", "NAS", "HATE", "HATES", "ENTASSA", "TENTAS", "ZA", "AZ"});
+
+    Board board = Board::parseBoard(R"(
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        ...............
+        .......CHAT....
+        ........A......
+        ........T......
+        ........E......
+        ...............
+        ...............
+        ...............
+        ...............
+    )");
+
+    vector<string> racks = {"SENAT?E", "ANSSATE", "TE?", "SE??", "ZA", "QQ"};
+    for (const string& tiles : racks) {
+        Rack rack(tiles);
+        MoveGenerator generator(board, rack, dawg);
+
+        // Every move tying the highest score, in generation order
+        vector<Move> all_moves = generator.generateMoves();
+        int best_score = 0;
+        for (const auto& move : all_moves) {
+            best_score = std::max(best_score, move.getScore());
+        }
+        vector<string> expected;
+        for (const auto& move : all_moves) {
+            if (move.getScore() == best_score) {
+                expected.push_back(move.toString());
+            }
+        }
+
+        vector<string> actual;
+        for (const auto& move : generator.getBestMove()) {
+            actual.push_back(move.toString());
+        }
+        assert_true(expected == actual, "Best-only search should return every tied best move for rack " + tiles);
+    }
+}
+
+void test_top_moves_match_full_sort() {
+    cout << "\n=== Test: Top Moves Match Full Sort ===" << endl;
+
+    DAWG dawg;
+    dawg.build({"CHAT", "CHATS", "CHATTE", "CHATTES", "ET", "TE", "AS", "SA", "ES", "TA", "AN", "NA", "HA", "AH",
+                "THE", "ETA", "TES", "SET", "ANS", "NAS", "HATE", "HATES", "ENTASSA", "TENTAS"});
+
+    Board board;
+    board.setLetter(7, 7, 'C');
+    board.setLetter(7, 8, 'H');
+    board.setLetter(7, 9, 'A');
+    board.setLetter(7, 10, 'T');
+
+    for (string tiles : {"SENAT?E", "TAS??"}) {
+        Rack rack(tiles);
+        MoveGenerator generator(board, rack, dawg);
+
+        // Reference: every move, stably sorted by descending score
+        vector<Move> all_moves = generator.generateMoves();
+        std::stable_sort(all_moves.begin(), all_moves.end(),
+                         [](const Move& a, const Move& b) { return a.getScore() > b.getScore(); });
+
+        for (int count : {1, 5, 20, 100000}) {
+            vector<Move> top_moves = generator.getTopMoves(count);
+            string label = "Top " + std::to_string(count) + " for rack " + tiles;
+            size_t expected_size = std::min<size_t>(count, all_moves.size());
+            assert_equal(expected_size, top_moves.size(), label + " size");
+
+            int mismatches = 0;
+            for (size_t i = 0; i < top_moves.size() && i < all_moves.size(); i++) {
+                if (top_moves[i].toString() != all_moves[i].toString() ||
+                    top_moves[i].getScore() != all_moves[i].getScore()) {
+                    mismatches++;
+                }
+            }
+            assert_equal(0, mismatches, label + " should match the full sort");
+        }
+
+        assert_true(generator.getTopMoves(0).empty(), "Top 0 should be empty");
+    }
+}
+
+void test_parallel_generation_matches_serial() {
+    cout << "\n=== Test: Parallel Generation Matches Serial ===" << endl;
+
+    DAWG dawg;
+    dawg.build(CHAT_WORDS);
+    Board board = chatBoard();
+
+    // More tiles than a rack holds, as when exploring with the whole bag
+    Rack rack("SENAT?EASTHE");
+    MoveGenerator serial(board, rack, dawg);
+    MoveGenerator parallel(board, rack, dawg);
+    parallel.setThreads(4);
+
+    vector<Move> serial_moves = serial.generateMoves();
+    assert_true(!serial_moves.empty(), "Moves should be generated");
+    assert_true(describe(serial_moves) == describe(parallel.generateMoves()),
+                "Parallel generateMoves should match the serial order");
+    assert_true(describe(serial.getBestMove()) == describe(parallel.getBestMove()),
+                "Parallel getBestMove should match serial");
+    assert_true(describe(serial.getTopMoves(15)) == describe(parallel.getTopMoves(15)),
+                "Parallel getTopMoves should match serial");
+}
+
+void test_letter_count_generation() {
+    cout << "\n=== Test: Generation From Letter Counts ===" << endl;
+
+    DAWG dawg;
+    dawg.build(CHAT_WORDS);
+    Board board = chatBoard();
+
+    LetterCounts letters = MoveGenerator::countLetters("SENAT?E");
+    assert_equal(2, letters['E' - 'A'], "countLetters should count each letter");
+    assert_equal(1, letters[26], "countLetters should count blanks");
+
+    Rack rack("SENAT?E");
+    MoveGenerator from_rack(board, rack, dawg);
+    MoveGenerator from_counts(board, letters, dawg);
+    assert_true(describe(from_rack.generateMoves()) == describe(from_counts.generateMoves()),
+                "Letter counts should generate the same moves as the rack");
+
+    // A whole bag's worth of tiles, blanks included: the best-only search
+    // still finds every tied best move, with every best blank placement
+    LetterCounts bag = MoveGenerator::countLetters("AAAAEEEEEESSSSTTTTNNHHZ??");
+    MoveGenerator generator(board, bag, dawg);
+    vector<Move> all_moves = generator.generateMoves();
+    int best_score = 0;
+    for (const auto& move : all_moves) {
+        best_score = std::max(best_score, move.getScore());
+    }
+    vector<Move> expected;
+    for (const auto& move : all_moves) {
+        if (move.getScore() == best_score) {
+            expected.push_back(move);
+        }
+    }
+    assert_true(!expected.empty(), "Super-rack moves should be generated");
+    assert_true(describe(expected) == describe(generator.getBestMove()),
+                "Super-rack best-only search should return every tied best move");
+}
+
+void test_generator_reset() {
+    cout << "\n=== Test: Reused Generator Matches Fresh Ones ===" << endl;
+
+    DAWG dawg;
+    dawg.build(CHAT_WORDS);
+    Board empty_board;
+    Board board = chatBoard();
+
+    // One generator walks through several positions, larger and smaller
+    Rack first_rack("SENAT?E");
+    MoveGenerator reused(board, first_rack, dawg);
+    vector<std::pair<const Board*, string>> positions = {
+        {&board, "SENAT?E"}, {&empty_board, "CHATTES"}, {&board, "ZA"}, {&board, ""}, {&board, "TAS??"}};
+    for (const auto& position : positions) {
+        Rack rack(position.second);
+        reused.reset(*position.first, rack);
+        MoveGenerator fresh(*position.first, rack, dawg);
+        string label = " for rack '" + position.second + "'";
+        assert_true(describe(reused.generateMoves()) == describe(fresh.generateMoves()),
+                    "Reused generateMoves should match a fresh generator" + label);
+        assert_true(describe(reused.getBestMove()) == describe(fresh.getBestMove()),
+                    "Reused getBestMove should match a fresh generator" + label);
+        assert_true(describe(reused.getTopMoves(10)) == describe(fresh.getTopMoves(10)),
+                    "Reused getTopMoves should match a fresh generator" + label);
+    }
+}
+
+void test_board_analysis_shared() {
+    cout << "\n=== Test: Board Analysis Shared Across Racks ===" << endl;
+
+    DAWG dawg;
+    dawg.build(CHAT_WORDS);
+    GADDAG gaddag;
+    gaddag.build(CHAT_WORDS);
+
+    Board empty_board;
+    Board board = chatBoard();
+    board.setLetter(8, 10, 'E');
+
+    for (const Board* position : {&board, &empty_board}) {
+        BoardAnalysis analysis(*position, dawg);
+        assert_equal(MoveGenerator(*position, Rack(""), dawg).findStartPositions().size(),
+                     analysis.getStartPositions().size(), "Analysis should hold every start position");
+
+        for (string tiles : {"SENAT?E", "HATES", "T", "??"}) {
+            LetterCounts letters = MoveGenerator::countLetters(tiles);
+            string label = " for rack '" + tiles + "'";
+            MoveGenerator fresh(*position, letters, dawg);
+            MoveGenerator shared(analysis, letters);
+            MoveGenerator anchors(analysis, letters, gaddag);
+            assert_true(describe(shared.generateMoves()) == describe(fresh.generateMoves()),
+                        "Shared analysis generateMoves should match" + label);
+            assert_true(describe(anchors.generateMoves()) == describe(fresh.generateMoves()),
+                        "Shared analysis anchor engine should match" + label);
+            assert_true(describe(shared.getBestMove()) == describe(fresh.getBestMove()),
+                        "Shared analysis getBestMove should match" + label);
+            assert_true(describe(anchors.getTopMoves(5)) == describe(fresh.getTopMoves(5)),
+                        "Shared analysis getTopMoves should match" + label);
+        }
+    }
+}
+
 void test_word_validation() {
     cout << "\n=== Test: Word Validation (Only Valid Words) ===" << endl;
 
@@ -778,6 +1138,7 @@ int main() {
     test_start_positions();
     test_start_positions_empty_board();
     test_move_structure();
+    test_move_full_row_copy();
     test_tile_placement();
 
     // raw move generation
@@ -802,6 +1163,14 @@ int main() {
     test_move_with_existing_tiles();
 
     test_raw_moves_basic();
+    test_generated_scores_match_scorer();
+    test_for_each_move_visitor();
+    test_best_move_matches_full_search();
+    test_top_moves_match_full_sort();
+    test_parallel_generation_matches_serial();
+    test_letter_count_generation();
+    test_generator_reset();
+    test_board_analysis_shared();
 
     print_summary();
 
@@ -0,0 +1,85 @@
+#include <iostream>
+#include <type_traits>
+#include <unordered_map>
+
+#include "board.h"
+#include "move.h"
+#include "rule_set.h"
+#include "scorer.h"
+#include "test_framework.h"
+#include "tile_bag.h"
+
+using namespace scradle;
+using namespace test;
+using std::cout;
+using std::endl;
+
+// Built by `make test-english-rules`, against objects compiled with
+// -DSCRADLE_RULES_ENGLISH: the other suites check the French game.
+static_assert(std::is_same<Rules, EnglishRules>::value, "test_rule_set is built for the English rules");
+
+void test_english_letter_values() {
+    cout << "\n=== Test: English Letter Values ===" << endl;
+
+    assert_equal(1, Scorer::getLetterValue('E'), "'E' should be worth 1 point");
+    assert_equal(3, Scorer::getLetterValue('M'), "'M' should be worth 3 points");
+    assert_equal(4, Scorer::getLetterValue('W'), "'W' should be worth 4 points");
+    assert_equal(4, Scorer::getLetterValue('Y'), "'Y' should be worth 4 points");
+    assert_equal(5, Scorer::getLetterValue('K'), "'K' should be worth 5 points");
+    assert_equal(8, Scorer::getLetterValue('X'), "'X' should be worth 8 points");
+    assert_equal(10, Scorer::getLetterValue('Q'), "'Q' should be worth 10 points");
+    assert_equal(10, Scorer::getLetterValue('Z'), "'Z' should be worth 10 points");
+    assert_equal(0, Scorer::getLetterValue('?'), "Blanks should be worth 0 points");
+}
+
+void test_english_premium_squares() {
+    cout << "\n=== Test: English Premium Squares ===" << endl;
+
+    Board board;
+    assert_true(board.getCell(0, 0).premium == PremiumType::TRIPLE_WORD, "(0,0) should be a triple word");
+    assert_true(board.getCell(7, 7).premium == PremiumType::DOUBLE_WORD, "The centre should be a double word");
+    assert_true(board.getCell(1, 5).premium == PremiumType::TRIPLE_LETTER, "(1,5) should be a triple letter");
+    assert_true(board.getCell(0, 3).premium == PremiumType::DOUBLE_LETTER, "(0,3) should be a double letter");
+    assert_true(board.getCell(7, 8).premium == PremiumType::NONE, "(7,8) should be a plain square");
+
+    // K(5) E(1) Y(4) across the centre double word
+    Scorer scorer;
+    Move move(7, 7, Direction::HORIZONTAL, "KEY");
+    move.addPlacement(TilePlacement(7, 7, 'K', true));
+    move.addPlacement(TilePlacement(7, 8, 'E', true));
+    move.addPlacement(TilePlacement(7, 9, 'Y', true));
+    assert_equal(20, scorer.scoreMove(board, move), "KEY on the centre should score 20");
+}
+
+void test_english_tile_bag() {
+    cout << "\n=== Test: English Tile Bag ===" << endl;
+
+    assert_equal(100, TileBag::TOTAL_TILES, "The English bag should hold 100 tiles");
+
+    TileBag bag(2024);
+    std::unordered_map<char, int> distribution;
+    while (!bag.isEmpty()) {
+        distribution[bag.drawTile()]++;
+    }
+    assert_equal(12, distribution['E'], "Bag should hold 12 E");
+    assert_equal(8, distribution['O'], "Bag should hold 8 O");
+    assert_equal(4, distribution['S'], "Bag should hold 4 S");
+    assert_equal(2, distribution['Y'], "Bag should hold 2 Y");
+    assert_equal(1, distribution['Z'], "Bag should hold 1 Z");
+    assert_equal(2, distribution['?'], "Bag should hold 2 blanks");
+
+    assert_true(TileBag::isVowel('U'), "U should be a vowel");
+    assert_true(!TileBag::isVowel('Y'), "Y should not be a vowel in English");
+    assert_true(TileBag::isConsonant('Y'), "Y should be a consonant in English");
+}
+
+int main() {
+    cout << "=== English Rule Set Tests ===" << endl;
+
+    test_english_letter_values();
+    test_english_premium_squares();
+    test_english_tile_bag();
+
+    print_summary();
+    return exit_code();
+}
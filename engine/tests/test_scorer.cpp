@@ -58,6 +58,29 @@ void test_letter_values() {
     assert_equal(10, scorer.getLetterValue('z'), "lowercase 'z' should be worth 10 points");
 }
 
+void test_constexpr_tables() {
+    cout << "\n=== Test: Compile-Time Scoring Tables ===" << endl;
+
+    static_assert(Scorer::LETTER_VALUES['K' - 'A'] == 10, "Letter values are a constant table");
+    static_assert(STANDARD_LAYOUT.at(7, 7) == PremiumType::DOUBLE_WORD, "Center is a double word");
+    static_assert(Scorer::wordMultiplier(STANDARD_LAYOUT.at(0, 0)) == 3, "Corners are triple words");
+
+    assert_equal(0, Scorer::getLetterValue('?'), "Blank should be worth 0 points");
+    assert_equal(0, Scorer::getLetterValue(' '), "Non-letters should be worth 0 points");
+
+    Board board;
+    int mismatches = 0;
+    for (int row = 0; row < Board::SIZE; row++) {
+        for (int col = 0; col < Board::SIZE; col++) {
+            if (board.getCell(row, col).premium != STANDARD_LAYOUT.at(row, col) ||
+                STANDARD_LAYOUT.at(row, col) != STANDARD_LAYOUT.at(col, row)) {
+                mismatches++;
+            }
+        }
+    }
+    assert_equal(0, mismatches, "Board premiums should follow the symmetric standard layout");
+}
+
 void test_basic_word_scoring() {
     cout << "\n=== Test: Basic Word Scoring ===" << endl;
 
@@ -346,6 +369,7 @@ int main() {
     cout << "Testing Scoring System" << endl;
 
     test_letter_values();
+    test_constexpr_tables();
     test_basic_word_scoring();
     test_double_letter_scoring();
     test_triple_letter_scoring();
@@ -266,6 +266,30 @@ void test_can_draw_tiles_multiple_of_same_letter() {
     assert_true(bag.canDrawTiles("AAAAAAAAAAA"), "Should be able to draw 11 A's (9 A + 2 jokers)");
 }
 
+void test_tile_bag_follows_rule_set() {
+    cout << "\n"
+         << color::BLUE << color::BOLD << "=== Test: TileBag Follows Rule Set ===" << color::RESET << endl;
+
+    TileBag bag(2024);
+    assert_equal(TileBag::TOTAL_TILES, bag.remainingCount(), "Full bag should hold TOTAL_TILES");
+
+    std::unordered_map<char, int> distribution;
+    while (!bag.isEmpty()) {
+        distribution[bag.drawTile()]++;
+    }
+
+    bool counts_match = distribution['?'] == Rules::TILE_COUNTS[26];
+    for (int i = 0; i < 26; i++) {
+        counts_match = counts_match && distribution['A' + i] == Rules::TILE_COUNTS[i];
+    }
+    assert_true(counts_match, "Bag contents should match Rules::TILE_COUNTS");
+
+    assert_true(TileBag::isVowel('E'), "E should be a vowel");
+    assert_true(!TileBag::isVowel('T'), "T should not be a vowel");
+    assert_equal(((Rules::VOWELS >> ('Y' - 'A')) & 1) != 0, TileBag::isVowel('Y'), "Y should follow the rule set");
+    assert_true(TileBag::isVowel('?') && TileBag::isConsonant('?'), "Blanks should count as both");
+}
+
 int main() {
     cout << "=== Tile Bag Tests ===" << endl;
 
@@ -282,6 +306,7 @@ int main() {
     test_can_draw_tiles_with_joker_fallback();
     test_can_draw_tiles_insufficient_letters();
     test_can_draw_tiles_multiple_of_same_letter();
+    test_tile_bag_follows_rule_set();
 
     print_summary();
     return exit_code();
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <iostream>
+
+#include "dawg.h"
+
+using namespace scradle;
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && (string(argv[1]) == "-h" || string(argv[1]) == "--help")) {
+        cout << "Usage: " << argv[0] << " [input_words] [output_dawg]" << endl;
+        cout << "  input_words: Word list, one word per line (default: engine/dictionnaries/ods8_complete.txt)" << endl;
+        cout << "  output_dawg: Compiled binary DAWG (default: engine/dictionnaries/ods8_complete.dawg)" << endl;
+        return 0;
+    }
+
+    string input = argc > 1 ? argv[1] : "engine/dictionnaries/ods8_complete.txt";
+    string output = argc > 2 ? argv[2] : "engine/dictionnaries/ods8_complete.dawg";
+
+    auto start = chrono::high_resolution_clock::now();
+
+    DAWG dawg;
+    if (!dawg.loadFromFile(input)) {
+        cerr << "Failed to load word list: " << input << endl;
+        return 1;
+    }
+
+    if (!dawg.saveBinary(output)) {
+        cerr << "Failed to write compiled dictionary: " << output << endl;
+        return 1;
+    }
+
+    auto duration = chrono::duration_cast<chrono::milliseconds>(
+                        chrono::high_resolution_clock::now() - start)
+                        .count();
+
+    cout << "Compiled " << dawg.getWordCount() << " words into " << output << endl;
+    cout << "  " << dawg.getNodeCount() << " nodes, " << dawg.getEdgeCount() << " edges, "
+         << dawg.getByteSize() / 1024 << " KB (" << duration << " ms)" << endl;
+
+    // Sanity check: the compiled file must map back to the same graph
+    DAWG mapped;
+    if (!mapped.loadMapped(output) || mapped.getWordCount() != dawg.getWordCount() ||
+        mapped.getNodeCount() != dawg.getNodeCount()) {
+        cerr << "Compiled dictionary failed verification: " << output << endl;
+        return 1;
+    }
+
+    return 0;
+}
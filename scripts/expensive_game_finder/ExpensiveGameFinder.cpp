@@ -15,7 +15,9 @@
 namespace scradle {
 
 ExpensiveGameFinder::ExpensiveGameFinder(const DAWG& dawg, unsigned int seed)
-    : game_state_(seed), dawg_(dawg), rng_(seed) {}
+    : game_state_(seed), dawg_(dawg), rng_(seed) {
+    game_state_.setDictionary(dawg_);
+}
 
 int ExpensiveGameFinder::findExpensiveGame() {
     const int MAX_MAIN_LOOPS = 100000;                  // Prevent infinite loops
@@ -61,7 +63,7 @@ int ExpensiveGameFinder::findExpensiveGame() {
     int rejected_in_a_row = 0;
     int previous_needed_tiles =
         45;  // Start with maximum (3 words × 15 letters)
-    std::unordered_set<std::string> seen_grids;  // Track seen grid states
+    std::unordered_set<uint64_t> seen_grids;  // Track seen grid states (Board::hash)
 
     // Rolling window for progress tracking
     std::vector<bool> progress_history;  // Track whether each move made progress
@@ -136,7 +138,8 @@ int ExpensiveGameFinder::findExpensiveGame() {
 
         // Generate all possible moves
         MoveGenerator move_gen(game_state_.getBoard(), game_state_.getRack(),
-                               dawg_);
+                               dawg_, game_state_.getCrossChecks());
+        move_gen.setCache(&move_cache_);
         std::vector<Move> best_moves = move_gen.getBestMove();
 
         if (best_moves.empty()) {
@@ -170,7 +173,7 @@ int ExpensiveGameFinder::findExpensiveGame() {
         bool early_move = game_state_.getMoveCount() <= 3;
 
         // Check if we've already seen this grid state
-        std::string current_grid = game_state_.getBoard().toString();
+        uint64_t current_grid = game_state_.getBoard().hash();
         bool already_seen = seen_grids.count(current_grid) > 0;
 
         // Check rolling window: allow non-progressive moves if we made progress
@@ -245,6 +248,8 @@ int ExpensiveGameFinder::findExpensiveGame() {
     std::cout << "- " << main_word2 << std::endl;
     std::cout << "- " << main_word3 << std::endl;
     game_state_.printSummary();
+    std::cout << "Move cache: " << move_cache_.hits() << " hits, " << move_cache_.misses() << " misses"
+              << std::endl;
 
     return game_state_.getTotalScore();
 }
@@ -880,6 +885,9 @@ bool ExpensiveGameFinder::tryPlaceSubstring(const std::string& substring,
     // Try multiple different racks to find one where the substring is the best move
     const int MAX_RACK_ATTEMPTS = 20;
 
+    // The board stays the same across attempts: analyse it once
+    BoardAnalysis analysis(board, dawg_, game_state_.getCrossChecks());
+
     for (int attempt = 0; attempt < MAX_RACK_ATTEMPTS; ++attempt) {
         // Build a 7-tile rack: needed tiles + random tiles to fill up to 7
         game_state_.getRack().clear();
@@ -900,7 +908,8 @@ bool ExpensiveGameFinder::tryPlaceSubstring(const std::string& substring,
         }
 
         // Generate all possible moves with this rack
-        MoveGenerator move_gen(board, game_state_.getRack(), dawg_);
+        MoveGenerator move_gen(analysis, MoveGenerator::countLetters(game_state_.getRack().getTiles()));
+        move_gen.setCache(&move_cache_);
         std::vector<Move> best_moves = move_gen.getBestMove();
 
         if(DEBUG) std::cout << "[DEBUG] -> Attempt " << (attempt + 1) << ": Generated " << best_moves.size() << " best moves" << std::endl;
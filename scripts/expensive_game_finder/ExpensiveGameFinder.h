@@ -5,6 +5,7 @@
 #include "../../engine/include/move_generator.h"
 #include "../../engine/include/dawg.h"
 #include "../../engine/include/move.h"
+#include "../../engine/include/move_cache.h"
 #include "CompatibleWordFinder.h"
 #include <vector>
 #include <string>
@@ -167,6 +168,7 @@ private:
     GameState game_state_;
     const DAWG& dawg_;
     std::mt19937 rng_;  // Random number generator initialized with seed
+    MoveCache move_cache_;  // Backtracking revisits boards with the same racks
 };
 
 }  // namespace scradle
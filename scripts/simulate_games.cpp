@@ -70,12 +70,14 @@ int main(int argc, char* argv[]) {
 
     // Load dictionary
     DAWG dawg;
-    if (!dawg.loadFromFile("engine/dictionnaries/ods8_complete.txt")) {
+    // Prefer the compiled dictionary (make compile-dictionary), fall back to the word list
+    if (!dawg.loadDictionary("engine/dictionnaries/ods8_complete.dawg", "engine/dictionnaries/ods8_complete.txt")) {
         cerr << "Failed to load dictionary" << endl;
         return 1;
     }
 
-    cout << "Dictionary loaded: " << dawg.getWordCount() << " words" << endl;
+    cout << "Dictionary loaded: " << dawg.getWordCount() << " words ("
+         << dawg.getNodeCount() << " nodes, " << dawg.getByteSize() / 1024 << " KB)" << endl;
     cout << "Simulating " << num_games << " games..." << endl
          << endl;
 
@@ -12,6 +12,8 @@ namespace scradle {
 TopEverytimeFinder::TopEverytimeFinder(const DAWG& dawg, const std::string& output_dir)
     : game_state_(), dawg_(dawg), output_dir_(output_dir),
       best_score_(0), games_explored_(0), nodes_explored_(0) {
+    game_state_.setDictionary(dawg_);
+
     // Create output directory if it doesn't exist
     mkdir(output_dir_.c_str(), 0755);
 }
@@ -64,7 +66,9 @@ void TopEverytimeFinder::dfsExploreGameTree(int depth) {
     std::vector<char> all_tiles = fillRackWithAllTiles();
 
     // Generate all moves with this super-rack
-    MoveGenerator move_gen(game_state_.getBoard(), game_state_.getRack(), dawg_);
+    MoveGenerator move_gen(game_state_.getBoard(), MoveGenerator::countLetters(game_state_.getRack().getTiles()), dawg_,
+                           game_state_.getCrossChecks());
+    move_gen.setThreads(0);  // A whole bag is a heavy search: use every core
     std::vector<Move> best_moves = move_gen.getBestMove();
     // Return all tiles back to bag before we start exploring
     returnAllTilesToBag(all_tiles);
@@ -245,9 +249,9 @@ void TopEverytimeFinder::logGame(int game_id) {
 
     // Write move history
     outfile << "Move History:" << std::endl;
-    const auto& moves = game_state_.getMoveHistory();
-    for (size_t i = 0; i < moves.size(); i++) {
-        outfile << "Move " << (i + 1) << ": " << moves[i].toString() << std::endl;
+    const auto& codes = game_state_.getMoveCodes();
+    for (size_t i = 0; i < codes.size(); i++) {
+        outfile << "Move " << (i + 1) << ": " << codes[i].decode(game_state_.getBoard()).toString() << std::endl;
     }
 
     outfile.close();
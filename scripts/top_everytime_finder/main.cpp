@@ -9,7 +9,8 @@ int main(int argc, char* argv[]) {
     // Load the DAWG dictionary
     DAWG dawg;
     std::cout << "Loading DAWG dictionary..." << std::endl;
-    if (!dawg.loadFromFile("engine/dictionnaries/ods8_complete.txt")) {
+    // Prefer the compiled dictionary (make compile-dictionary), fall back to the word list
+    if (!dawg.loadDictionary("engine/dictionnaries/ods8_complete.dawg", "engine/dictionnaries/ods8_complete.txt")) {
         std::cerr << "Error: Could not load DAWG file" << std::endl;
         return 1;
     }